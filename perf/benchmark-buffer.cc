@@ -0,0 +1,114 @@
+/*
+ * Benchmarks for filling hb_buffer_t from UTF-8 text.
+ */
+#include "benchmark/benchmark.h"
+#include <cstring>
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cassert>
+#include <string>
+
+#include "hb.h"
+
+static const char *default_texts[] =
+{
+  "perf/texts/en-thelittleprince.txt",
+  "perf/texts/en-words.txt",
+  "perf/texts/fa-thelittleprince.txt",
+  "perf/texts/fa-words.txt",
+  "perf/texts/hi-words.txt",
+};
+
+static const char **texts = default_texts;
+static unsigned num_texts = sizeof (default_texts) / sizeof (default_texts[0]);
+
+enum fill_mode_t {
+  LINES,	/* One hb_buffer_add_utf8() call per line, as when shaping. */
+  DOCUMENT,	/* The whole text, repeated to a few megabytes, in one call. */
+};
+
+static void BM_BufferAddUtf8 (benchmark::State &state,
+			      fill_mode_t mode,
+			      const char *text_path)
+{
+  hb_blob_t *text_blob = hb_blob_create_from_file_or_fail (text_path);
+  assert (text_blob);
+  unsigned orig_text_length;
+  const char *orig_text = hb_blob_get_data (text_blob, &orig_text_length);
+
+  std::string document;
+  if (mode == DOCUMENT)
+    while (document.size () < (4u << 20))
+      document.append (orig_text, orig_text_length);
+
+  hb_buffer_t *buf = hb_buffer_create ();
+  for (auto _ : state)
+  {
+    if (mode == DOCUMENT)
+    {
+      hb_buffer_clear_contents (buf);
+      hb_buffer_add_utf8 (buf, document.data (), document.size (), 0, -1);
+      benchmark::DoNotOptimize (hb_buffer_get_length (buf));
+      continue;
+    }
+
+    unsigned text_length = orig_text_length;
+    const char *text = orig_text;
+
+    const char *end;
+    while ((end = (const char *) memchr (text, '\n', text_length)))
+    {
+      hb_buffer_clear_contents (buf);
+      hb_buffer_add_utf8 (buf, text, text_length, 0, end - text);
+      benchmark::DoNotOptimize (hb_buffer_get_length (buf));
+
+      unsigned skip = end - text + 1;
+      text_length -= skip;
+      text += skip;
+    }
+  }
+  state.SetBytesProcessed (state.iterations () *
+			   (mode == DOCUMENT ? document.size () : orig_text_length));
+  hb_buffer_destroy (buf);
+
+  hb_blob_destroy (text_blob);
+}
+
+static void test_mode (fill_mode_t mode,
+		       const char *mode_name,
+		       const char *text_path)
+{
+  char name[1024] = "BM_BufferAddUtf8";
+  const char *p;
+  strcat (name, "/");
+  p = strrchr (text_path, '/');
+  strcat (name, p ? p + 1 : text_path);
+  strcat (name, "/");
+  strcat (name, mode_name);
+
+  benchmark::RegisterBenchmark (name, BM_BufferAddUtf8, mode, text_path)
+   ->Unit(benchmark::kMicrosecond);
+}
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+
+  if (argc > 1)
+  {
+    num_texts = argc - 1;
+    texts = (const char **) argv + 1;
+  }
+
+  for (unsigned i = 0; i < num_texts; i++)
+  {
+    test_mode (LINES, "lines", texts[i]);
+    test_mode (DOCUMENT, "document", texts[i]);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
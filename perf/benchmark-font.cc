@@ -1,6 +1,10 @@
 #include "benchmark/benchmark.h"
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <thread>
+#include <vector>
 
 #ifdef HAVE_CONFIG_H
 #include "config.h"
@@ -11,9 +15,13 @@
 #ifdef HAVE_FREETYPE
 #include "hb-ft.h"
 #endif
+#ifdef HAVE_CAIRO
+#include <cairo.h>
+#endif
 
 
 #define SUBSET_FONT_BASE_PATH "test/subset/data/fonts/"
+#define API_FONT_BASE_PATH "test/api/fonts/"
 
 struct test_input_t
 {
@@ -28,6 +36,7 @@ struct test_input_t
   {false, SUBSET_FONT_BASE_PATH "Comfortaa-Regular-new.ttf"},
   {false, SUBSET_FONT_BASE_PATH "NotoNastaliqUrdu-Regular.ttf"},
   {false, SUBSET_FONT_BASE_PATH "NotoSerifMyanmar-Regular.otf"},
+  {false, API_FONT_BASE_PATH "test_glyphs-glyf_colr_1.ttf"},
 };
 
 static test_input_t *tests = default_tests;
@@ -41,6 +50,15 @@ enum operation_t
   glyph_h_advances,
   glyph_extents,
   glyph_shape,
+  glyph_path,
+  paint_glyph,
+  paint_glyph_cached,
+  glyph_raster,
+  glyph_sdf,
+  glyph_sdf_threaded,
+#ifdef HAVE_CAIRO
+  glyph_raster_cairo,
+#endif
 };
 
 static void
@@ -70,6 +88,95 @@ _draw_funcs_create (void)
   return draw_funcs;
 }
 
+static void
+_hb_push_transform (hb_paint_funcs_t *, void *, float, float, float, float, float, float, void *) {}
+
+static void
+_hb_linear_gradient (hb_paint_funcs_t *, void *, hb_color_line_t *color_line,
+		     float, float, float, float, float, float, void *)
+{
+  hb_color_stop_t stops[16];
+  unsigned count = 16;
+  hb_color_line_get_color_stops (color_line, 0, &count, stops);
+}
+
+static void
+_hb_radial_gradient (hb_paint_funcs_t *, void *, hb_color_line_t *color_line,
+		     float, float, float, float, float, float, void *)
+{
+  hb_color_stop_t stops[16];
+  unsigned count = 16;
+  hb_color_line_get_color_stops (color_line, 0, &count, stops);
+}
+
+static void
+_hb_sweep_gradient (hb_paint_funcs_t *, void *, hb_color_line_t *color_line,
+		    float, float, float, float, void *)
+{
+  hb_color_stop_t stops[16];
+  unsigned count = 16;
+  hb_color_line_get_color_stops (color_line, 0, &count, stops);
+}
+
+#ifdef HAVE_CAIRO
+static void
+_cairo_move_to (hb_draw_funcs_t *, void *cr, hb_draw_state_t *, float x, float y, void *)
+{ cairo_move_to ((cairo_t *) cr, x, y); }
+
+static void
+_cairo_line_to (hb_draw_funcs_t *, void *cr, hb_draw_state_t *, float x, float y, void *)
+{ cairo_line_to ((cairo_t *) cr, x, y); }
+
+static void
+_cairo_cubic_to (hb_draw_funcs_t *, void *cr, hb_draw_state_t *,
+		 float x1, float y1, float x2, float y2, float x3, float y3, void *)
+{ cairo_curve_to ((cairo_t *) cr, x1, y1, x2, y2, x3, y3); }
+
+static void
+_cairo_close_path (hb_draw_funcs_t *, void *cr, hb_draw_state_t *, void *)
+{ cairo_close_path ((cairo_t *) cr); }
+
+static hb_draw_funcs_t *
+_cairo_draw_funcs_create (void)
+{
+  hb_draw_funcs_t *draw_funcs = hb_draw_funcs_create ();
+  hb_draw_funcs_set_move_to_func (draw_funcs, _cairo_move_to, nullptr, nullptr);
+  hb_draw_funcs_set_line_to_func (draw_funcs, _cairo_line_to, nullptr, nullptr);
+  hb_draw_funcs_set_cubic_to_func (draw_funcs, _cairo_cubic_to, nullptr, nullptr);
+  hb_draw_funcs_set_close_path_func (draw_funcs, _cairo_close_path, nullptr, nullptr);
+  return draw_funcs;
+}
+#endif
+
+static hb_paint_funcs_t *
+_paint_funcs_create (void)
+{
+  hb_paint_funcs_t *paint_funcs = hb_paint_funcs_create ();
+  hb_paint_funcs_set_push_transform_func (paint_funcs, _hb_push_transform, nullptr, nullptr);
+  hb_paint_funcs_set_linear_gradient_func (paint_funcs, _hb_linear_gradient, nullptr, nullptr);
+  hb_paint_funcs_set_radial_gradient_func (paint_funcs, _hb_radial_gradient, nullptr, nullptr);
+  hb_paint_funcs_set_sweep_gradient_func (paint_funcs, _hb_sweep_gradient, nullptr, nullptr);
+  return paint_funcs;
+}
+
+static void
+_render_glyph_sdf (hb_font_t *font, hb_raster_t *raster, hb_codepoint_t gid,
+		   std::vector<uint8_t> &sdf)
+{
+  const int spread = 4;
+  hb_raster_clear (raster);
+  hb_font_draw_glyph (font, gid, hb_raster_get_draw_funcs (), raster);
+  hb_glyph_extents_t extents;
+  if (!hb_raster_get_extents (raster, &extents))
+    return;
+  extents.x_bearing -= spread;
+  extents.y_bearing += spread;
+  extents.width += 2 * spread;
+  extents.height -= 2 * spread;
+  sdf.resize (extents.width * -extents.height);
+  hb_raster_render_sdf (raster, &extents, spread, extents.width, sdf.data ());
+}
+
 static void BM_Font (benchmark::State &state,
 		     bool is_var, backend_t backend, operation_t operation,
 		     const test_input_t &test_input)
@@ -167,6 +274,128 @@ static void BM_Font (benchmark::State &state,
       break;
       hb_draw_funcs_destroy (draw_funcs);
     }
+    case glyph_path:
+    {
+      unsigned verbs_size = 1024;
+      unsigned coords_size = 4096;
+      uint8_t *verbs = (uint8_t *) calloc (verbs_size, sizeof (uint8_t));
+      float *coords = (float *) calloc (coords_size, sizeof (float));
+      for (auto _ : state)
+	for (unsigned gid = 0; gid < num_glyphs; ++gid)
+	{
+	  unsigned verbs_length = verbs_size;
+	  unsigned coords_length = coords_size;
+	  if (!hb_font_get_glyph_path (font, gid, HB_DRAW_PATH_FLAG_CUBICS_ONLY,
+				       &verbs_length, verbs,
+				       &coords_length, coords))
+	  {
+	    verbs_size = verbs_length;
+	    coords_size = coords_length;
+	    verbs = (uint8_t *) realloc (verbs, verbs_size * sizeof (uint8_t));
+	    coords = (float *) realloc (coords, coords_size * sizeof (float));
+	    hb_font_get_glyph_path (font, gid, HB_DRAW_PATH_FLAG_CUBICS_ONLY,
+				    &verbs_length, verbs,
+				    &coords_length, coords);
+	  }
+	}
+      free (coords);
+      free (verbs);
+      break;
+    }
+    case paint_glyph:
+    case paint_glyph_cached:
+    {
+      if (operation == paint_glyph_cached)
+	hb_ot_font_set_paint_cache_capacity (font, num_glyphs);
+      hb_paint_funcs_t *paint_funcs = _paint_funcs_create ();
+      for (auto _ : state)
+	for (unsigned gid = 0; gid < num_glyphs; ++gid)
+	  hb_font_paint_glyph (font, gid, paint_funcs, nullptr, 0, HB_COLOR (0, 0, 0, 255));
+      hb_paint_funcs_destroy (paint_funcs);
+      break;
+    }
+    case glyph_raster:
+    {
+      /* Rasterize at a typical text size of 32 pixels per em. */
+      hb_font_set_scale (font, 32, 32);
+      hb_raster_t *raster = hb_raster_create ();
+      std::vector<uint8_t> mask;
+      for (auto _ : state)
+	for (unsigned gid = 0; gid < num_glyphs; ++gid)
+	{
+	  hb_raster_clear (raster);
+	  hb_font_draw_glyph (font, gid, hb_raster_get_draw_funcs (), raster);
+	  hb_glyph_extents_t extents;
+	  if (!hb_raster_get_extents (raster, &extents))
+	    continue;
+	  mask.resize (extents.width * -extents.height);
+	  hb_raster_render (raster, &extents, extents.width, mask.data ());
+	}
+      hb_raster_destroy (raster);
+      break;
+    }
+    case glyph_sdf:
+    {
+      hb_font_set_scale (font, 32, 32);
+      hb_raster_t *raster = hb_raster_create ();
+      std::vector<uint8_t> sdf;
+      for (auto _ : state)
+	for (unsigned gid = 0; gid < num_glyphs; ++gid)
+	  _render_glyph_sdf (font, raster, gid, sdf);
+      hb_raster_destroy (raster);
+      break;
+    }
+    case glyph_sdf_threaded:
+    {
+      /* Splits the glyphs over one rasterizer per thread, sharing the font. */
+      hb_font_set_scale (font, 32, 32);
+      unsigned num_threads = std::max (std::thread::hardware_concurrency (), 1u);
+      for (auto _ : state)
+      {
+	std::vector<std::thread> threads;
+	for (unsigned t = 0; t < num_threads; t++)
+	  threads.emplace_back ([=] ()
+	  {
+	    hb_raster_t *raster = hb_raster_create ();
+	    std::vector<uint8_t> sdf;
+	    for (unsigned gid = t; gid < num_glyphs; gid += num_threads)
+	      _render_glyph_sdf (font, raster, gid, sdf);
+	    hb_raster_destroy (raster);
+	  });
+	for (auto &thread : threads)
+	  thread.join ();
+      }
+      break;
+    }
+#ifdef HAVE_CAIRO
+    case glyph_raster_cairo:
+    {
+      /* The same as glyph_raster, filling the outlines with cairo the
+       * way util/view-cairo.hh does. */
+      hb_font_set_scale (font, 32, 32);
+      hb_draw_funcs_t *draw_funcs = _cairo_draw_funcs_create ();
+      for (auto _ : state)
+	for (unsigned gid = 0; gid < num_glyphs; ++gid)
+	{
+	  hb_glyph_extents_t extents;
+	  if (!hb_font_get_glyph_extents (font, gid, &extents) ||
+	      !extents.width || !extents.height)
+	    continue;
+	  cairo_surface_t *surface = cairo_image_surface_create (CAIRO_FORMAT_A8,
+								 abs (extents.width) + 2,
+								 abs (extents.height) + 2);
+	  cairo_t *cr = cairo_create (surface);
+	  cairo_translate (cr, 1 - extents.x_bearing, 1 + extents.y_bearing);
+	  cairo_scale (cr, 1, -1);
+	  hb_font_draw_glyph (font, gid, draw_funcs, cr);
+	  cairo_fill (cr);
+	  cairo_destroy (cr);
+	  cairo_surface_destroy (surface);
+	}
+      hb_draw_funcs_destroy (draw_funcs);
+      break;
+    }
+#endif
   }
 
 
@@ -234,6 +463,15 @@ int main(int argc, char** argv)
   TEST_OPERATION (glyph_h_advances, benchmark::kMicrosecond);
   TEST_OPERATION (glyph_extents, benchmark::kMicrosecond);
   TEST_OPERATION (glyph_shape, benchmark::kMicrosecond);
+  TEST_OPERATION (glyph_path, benchmark::kMicrosecond);
+  TEST_OPERATION (paint_glyph, benchmark::kMicrosecond);
+  TEST_OPERATION (paint_glyph_cached, benchmark::kMicrosecond);
+  TEST_OPERATION (glyph_raster, benchmark::kMicrosecond);
+  TEST_OPERATION (glyph_sdf, benchmark::kMicrosecond);
+  TEST_OPERATION (glyph_sdf_threaded, benchmark::kMicrosecond);
+#ifdef HAVE_CAIRO
+  TEST_OPERATION (glyph_raster_cairo, benchmark::kMicrosecond);
+#endif
 
 #undef TEST_OPERATION
 
@@ -0,0 +1,289 @@
+/*
+ * Benchmarks for hb_resolve_overflows() / graph::graph_t.
+ */
+#include "benchmark/benchmark.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "hb-repacker.hh"
+
+#define GRAPHS_BASE_PATH "perf/graphs/"
+
+/*
+ * Graphs recorded from real GSUB/GPOS tables, by building with
+ * HB_REPACKER_DUMP_GRAPHS defined and subsetting the fonts. The format
+ * is the same as the repacker fuzzer seeds in test/fuzzing/graphs.
+ */
+static const char *default_graphs[] =
+{
+  GRAPHS_BASE_PATH "SourceSerifVariable-Roman.GPOS.graph",
+  "test/fuzzing/graphs/noto_nastaliq_urdu",
+  GRAPHS_BASE_PATH "Harmattan-Regular.GPOS.graph",
+};
+
+static void
+add_object (const char* data, unsigned len, hb_serialize_context_t* c)
+{
+  char* obj = c->allocate_size<char> (len);
+  hb_memcpy (obj, data, len);
+}
+
+template <typename OffsetType>
+static void
+add_offset (unsigned id, hb_serialize_context_t* c)
+{
+  OffsetType* offset = c->start_embed<OffsetType> ();
+  c->extend_min (offset);
+  c->add_link (*offset, id);
+}
+
+/*
+ * Builds a graph made of num_groups groups of subgraphs reached through 32 bit
+ * offsets from the root, similar to extension subtables in GSUB/GPOS. The
+ * subgraphs of a group are connected by a shared leaf (like a shared coverage
+ * table) so each group initially lands in a single space that is too large
+ * for 16 bit offsets. Resolution needs several rounds of space isolation and
+ * duplication to pack them.
+ */
+static void
+populate_graph (hb_serialize_context_t* c,
+                unsigned num_groups,
+                unsigned group_size)
+{
+  static const char data[20000] = {};
+
+  c->start_serialize<char> ();
+
+  hb_vector_t<unsigned> subtables;
+  for (unsigned g = 0; g < num_groups; g++)
+  {
+    c->push ();
+    add_object (data, 200 + g % 11, c);
+    unsigned shared = c->pop_pack (false);
+
+    for (unsigned i = 0; i < group_size; i++)
+    {
+      c->push ();
+      add_object (data, 12000 + (i % 13) * 16, c);
+      unsigned leaf = c->pop_pack (false);
+
+      c->push ();
+      add_object (data, 16, c);
+      add_offset<OT::Offset16> (leaf, c);
+      add_offset<OT::Offset16> (shared, c);
+      subtables.push (c->pop_pack (false));
+    }
+  }
+
+  c->push ();
+  add_object (data, 4, c);
+  for (unsigned subtable : subtables)
+    add_offset<OT::Offset32> (subtable, c);
+  c->pop_pack (false);
+
+  c->end_serialize ();
+}
+
+/* Resolve overflows on a graph with a varying number of objects. */
+static void BM_ResolveOverflows (benchmark::State& state)
+{
+  unsigned num_groups = state.range (0);
+  unsigned group_size = 16;
+
+  size_t buffer_size = num_groups * group_size * 12500 + num_groups * 300 + 1000;
+  void* buffer = malloc (buffer_size);
+  hb_serialize_context_t c (buffer, buffer_size);
+  populate_graph (&c, num_groups, group_size);
+  assert (!c.in_error () || c.only_offset_overflow ());
+
+  graph_t::stats_t stats;
+  unsigned num_objects = 0;
+  for (auto _ : state)
+  {
+    graph_t graph (c.object_graph ());
+    num_objects = graph.vertices_.length;
+    bool result = hb_resolve_graph_overflows (HB_TAG ('G','S','U','B'),
+                                              10000,
+                                              false,
+                                              graph);
+    assert (result);
+    benchmark::DoNotOptimize (result);
+    stats = graph.stats;
+  }
+
+  state.counters["objects"] = num_objects;
+  state.counters["rounds"] = stats.resolution_rounds;
+  state.counters["sorts"] = stats.sorts;
+  state.counters["full_distance_updates"] = stats.full_distance_updates;
+  state.counters["incremental_distance_updates"] = stats.incremental_distance_updates;
+
+  free (buffer);
+}
+BENCHMARK (BM_ResolveOverflows)
+    ->Unit (benchmark::kMillisecond)
+    ->RangeMultiplier (4)
+    ->Range (1, 1 << 8); // Number of groups
+
+
+struct recorded_graph_t
+{
+  typedef hb_serialize_context_t::object_t object_t;
+
+  hb_tag_t table_tag = HB_TAG_NONE;
+  hb_bytes_t data;
+  hb_vector_t<unsigned> object_starts;
+  hb_vector_t<unsigned> object_sizes;
+  hb_vector_t<hb_vector_t<object_t::link_t>> links;
+
+  template <typename T>
+  bool read (unsigned& pos, T* out) const
+  {
+    if (pos + sizeof (T) > data.length) return false;
+    hb_memcpy ((void *) out, data.arrayZ + pos, sizeof (T));
+    pos += sizeof (T);
+    return true;
+  }
+
+  /* See test/fuzzing/hb-repacker-fuzzer.cc for a description of the format. */
+  bool load (hb_blob_t *blob)
+  {
+    data = hb_bytes_t (hb_blob_get_data (blob, nullptr), hb_blob_get_length (blob));
+
+    unsigned pos = 0;
+    uint16_t num_objects;
+    if (!read (pos, &table_tag) || !read (pos, &num_objects)) return false;
+
+    for (unsigned i = 0; i < num_objects; i++)
+    {
+      uint16_t size;
+      if (!read (pos, &size) || pos + size > data.length) return false;
+      object_starts.push (pos);
+      object_sizes.push (size);
+      pos += size;
+    }
+    links.resize (num_objects);
+
+    struct
+    {
+      uint16_t parent;
+      uint16_t child;
+      uint16_t position;
+      uint8_t width;
+    } link;
+    uint16_t num_links;
+    if (!read (pos, &num_links)) return false;
+    for (unsigned i = 0; i < num_links; i++)
+    {
+      if (!read (pos, &link) || link.parent >= num_objects) return false;
+      auto *l = links[link.parent].push ();
+      l->width = link.width;
+      l->position = link.position;
+      // Indices are shifted by 1 by the null object.
+      l->objidx = link.child + 1;
+    }
+
+    return !object_starts.in_error () &&
+           !object_sizes.in_error () &&
+           !links.in_error ();
+  }
+
+  /*
+   * Returns a fresh copy of the graph, the repacker modifies object
+   * data in place when splitting subtables.
+   */
+  void copy (hb_vector_t<char>& buffer,
+             hb_vector_t<object_t>& out,
+             hb_vector_t<const object_t *>& packed) const
+  {
+    buffer.resize (data.length);
+    out.resize (links.length);
+    packed.resize (0);
+    packed.push (nullptr);
+    char *head = buffer.arrayZ;
+    for (unsigned i = 0; i < links.length; i++)
+    {
+      hb_memcpy (head, data.arrayZ + object_starts[i], object_sizes[i]);
+      out[i].head = head;
+      out[i].tail = head + object_sizes[i];
+      out[i].real_links = links[i];
+      head += object_sizes[i];
+      packed.push (&out[i]);
+    }
+  }
+};
+
+/* Resolve overflows on a graph recorded from a real font. */
+static void BM_RepackRecordedGraph (benchmark::State& state,
+                                    const char *graph_path)
+{
+  hb_blob_t *blob = hb_blob_create_from_file_or_fail (graph_path);
+  assert (blob);
+  recorded_graph_t recorded;
+  bool loaded = recorded.load (blob);
+  assert (loaded);
+  (void) loaded;
+
+  hb_vector_t<char> buffer;
+  hb_vector_t<recorded_graph_t::object_t> objects;
+  hb_vector_t<const recorded_graph_t::object_t *> packed;
+
+  graph_t::stats_t stats;
+  unsigned final_size = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming ();
+    recorded.copy (buffer, objects, packed);
+    state.ResumeTiming ();
+
+    graph_t graph (packed);
+    bool result = hb_resolve_graph_overflows (recorded.table_tag,
+                                              20,
+                                              true,
+                                              graph);
+    assert (result);
+    benchmark::DoNotOptimize (result);
+    hb_blob_t *out = graph::serialize (graph);
+    assert (out);
+
+    final_size = hb_blob_get_length (out);
+    stats = graph.stats;
+    hb_blob_destroy (out);
+  }
+
+  state.counters["objects"] = recorded.links.length;
+  unsigned input_size = 0;
+  for (unsigned size : recorded.object_sizes)
+    input_size += size;
+  state.counters["input_size"] = input_size;
+  state.counters["final_size"] = final_size;
+  state.counters["rounds"] = stats.resolution_rounds;
+  state.counters["sorts"] = stats.sorts;
+
+  hb_blob_destroy (blob);
+}
+
+int main (int argc, char** argv)
+{
+  benchmark::Initialize (&argc, argv);
+
+  const char **graphs = default_graphs;
+  unsigned num_graphs = sizeof (default_graphs) / sizeof (default_graphs[0]);
+  if (argc > 1)
+  {
+    graphs = (const char **) argv + 1;
+    num_graphs = argc - 1;
+  }
+
+  for (unsigned i = 0; i < num_graphs; i++)
+  {
+    char name[1024] = "BM_RepackRecordedGraph/";
+    const char *p = strrchr (graphs[i], '/');
+    strcat (name, p ? p + 1 : graphs[i]);
+    benchmark::RegisterBenchmark (name, BM_RepackRecordedGraph, graphs[i])
+        ->Unit (benchmark::kMillisecond);
+  }
+
+  benchmark::RunSpecifiedBenchmarks ();
+  benchmark::Shutdown ();
+}
@@ -14,6 +14,7 @@ enum operation_t
   subset_codepoints,
   subset_glyphs,
   instance,
+  desubroutinize,
 };
 
 struct axis_location_t
@@ -166,6 +167,16 @@ static void BM_subset (benchmark::State &state,
     }
     break;
 
+    case desubroutinize:
+    {
+      unsigned num_glyphs = hb_face_get_glyph_count (face);
+      AddGlyphs(num_glyphs, subset_size, input);
+      hb_subset_input_set_flags (input,
+                                 hb_subset_input_get_flags (input) |
+                                 HB_SUBSET_FLAGS_DESUBROUTINIZE);
+    }
+    break;
+
     case instance:
     {
       hb_set_t* all_codepoints = hb_set_create ();
@@ -200,6 +211,8 @@ static void test_subset (operation_t op,
 {
   if (op == instance && test_input.instance_opts == nullptr)
     return;
+  if (op == desubroutinize && !strstr (test_input.font_path, ".otf"))
+    return;
 
   char name[1024] = "BM_subset/";
   strcat (name, op_name);
@@ -248,6 +261,7 @@ int main(int argc, char** argv)
   TEST_OPERATION (subset_glyphs, benchmark::kMillisecond);
   TEST_OPERATION (subset_codepoints, benchmark::kMillisecond);
   TEST_OPERATION (instance, benchmark::kMillisecond);
+  TEST_OPERATION (desubroutinize, benchmark::kMillisecond);
 
 #undef TEST_OPERATION
 
@@ -168,11 +168,10 @@ struct ValueFormat : HBUINT16
     unsigned int format = *this;
     if (!format) return;
 
-    HBINT16 *x_placement = nullptr, *y_placement = nullptr, *x_adv = nullptr, *y_adv = nullptr;
-    if (format & xPlacement) x_placement = copy_value (c, new_format, xPlacement, *values++);
-    if (format & yPlacement) y_placement = copy_value (c, new_format, yPlacement, *values++);
-    if (format & xAdvance)   x_adv = copy_value (c, new_format, xAdvance, *values++);
-    if (format & yAdvance)   y_adv = copy_value (c, new_format, yAdvance, *values++);
+    HBINT16 *x_placement = copy_value (c, format, new_format, xPlacement, values);
+    HBINT16 *y_placement = copy_value (c, format, new_format, yPlacement, values);
+    HBINT16 *x_adv = copy_value (c, format, new_format, xAdvance, values);
+    HBINT16 *y_adv = copy_value (c, format, new_format, yAdvance, values);
 
     if (format & xPlaDevice)
     {
@@ -199,11 +198,19 @@ struct ValueFormat : HBUINT16
     }
   }
 
+  /* Copies the value for flag, advancing values past it if present. When
+   * instancing, new_format may have a value the source only carries as a
+   * device table, in which case a zero is written for the delta to go to. */
   HBINT16* copy_value (hb_serialize_context_t *c,
+                       unsigned int format,
                        unsigned int new_format,
                        Flags flag,
-                       Value value) const
+                       const Value *&values) const
   {
+    Value value;
+    value = 0;
+    if (format & flag) value = *values++;
+
     // Filter by new format.
     if (!(new_format & flag)) return nullptr;
     return reinterpret_cast<HBINT16 *> (c->copy (value));
@@ -246,13 +253,13 @@ struct ValueFormat : HBUINT16
     }
   }
 
+  /* Format for a fully instanced record: the device tables are dropped and
+   * their deltas baked into the values, so each device needs the matching
+   * value. */
   unsigned drop_device_table_flags () const
   {
     unsigned format = *this;
-    for (unsigned flag = xPlaDevice; flag <= yAdvDevice; flag = flag << 1)
-      format = format & ~flag;
-
-    return format;
+    return (format & ~devices) | ((format & devices) >> 4);
   }
 
   private:
@@ -136,9 +136,13 @@ struct Glyph
     update_mtx (plan, roundf (xMin), roundf (yMax), all_points);
 
     /*for empty glyphs: all_points only include phantom points.
-     *just update metrics and then return */
+     *just update metrics and then return; dest_bytes may still point into
+     *the source glyph, so reset it */
     if (!glyph_header)
+    {
+      dest_bytes = hb_bytes_t ();
       return true;
+    }
 
     glyph_header->numberOfContours = header->numberOfContours;
     glyph_header->xMin = roundf (xMin);
@@ -153,10 +157,13 @@ struct Glyph
   bool compile_bytes_with_deltas (const hb_subset_plan_t *plan,
                                   hb_font_t *font,
                                   const glyf_accelerator_t &glyf,
+                                  contour_point_vector_t &all_points, /* scratch */
+                                  contour_point_vector_t &deltas, /* scratch */
                                   hb_bytes_t &dest_start,  /* IN/OUT */
                                   hb_bytes_t &dest_end /* OUT */)
   {
-    contour_point_vector_t all_points, deltas;
+    all_points.resize (0);
+    deltas.resize (0);
     if (!get_points (font, glyf, all_points, &deltas, false, false))
       return false;
 
@@ -207,7 +214,8 @@ struct Glyph
 		   bool use_my_metrics = true,
 		   bool phantom_only = false,
 		   hb_array_t<int> coords = hb_array_t<int> (),
-		   unsigned int depth = 0) const
+		   unsigned int depth = 0,
+		   const gvar_accelerator_t::cache_t *gvar_cache = nullptr /* for font->coords only */) const
   {
     if (unlikely (depth > HB_MAX_NESTING_LEVEL)) return false;
 
@@ -280,7 +288,8 @@ struct Glyph
 #ifndef HB_NO_VAR
     glyf_accelerator.gvar->apply_deltas_to_points (gid,
 						   coords,
-						   points.as_array ());
+						   points.as_array (),
+						   gvar_cache);
 #endif
 
     // mainly used by CompositeGlyph calculating new X/Y offset value so no need to extend it
@@ -316,7 +325,8 @@ struct Glyph
 						    use_my_metrics,
 						    phantom_only,
 						    coords,
-						    depth + 1)))
+						    depth + 1,
+						    gvar_cache)))
 	  return false;
 
 	/* Copy phantom points from component if USE_MY_METRICS flag set */
@@ -417,10 +427,11 @@ struct Glyph
   }
 
   bool get_extents_without_var_scaled (hb_font_t *font, const glyf_accelerator_t &glyf_accelerator,
-				       hb_glyph_extents_t *extents) const
+				       hb_glyph_extents_t *extents,
+				       bool scaled = true) const
   {
     if (type == EMPTY) return true; /* Empty glyph; zero extents. */
-    return header->get_extents_without_var_scaled (font, glyf_accelerator, gid, extents);
+    return header->get_extents_without_var_scaled (font, glyf_accelerator, gid, extents, scaled);
   }
 
   hb_bytes_t get_bytes () const { return bytes; }
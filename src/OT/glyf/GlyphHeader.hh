@@ -15,7 +15,8 @@ struct GlyphHeader
 
   template <typename accelerator_t>
   bool get_extents_without_var_scaled (hb_font_t *font, const accelerator_t &glyf_accelerator,
-				       hb_codepoint_t gid, hb_glyph_extents_t *extents) const
+				       hb_codepoint_t gid, hb_glyph_extents_t *extents,
+				       bool scaled = true) const
   {
     /* Undocumented rasterizer behavior: shift glyph to the left by (lsb - xMin), i.e., xMin = lsb */
     /* extents->x_bearing = hb_min (glyph_header.xMin, glyph_header.xMax); */
@@ -26,7 +27,8 @@ struct GlyphHeader
     extents->width     = hb_max (xMin, xMax) - hb_min (xMin, xMax);
     extents->height    = hb_min (yMin, yMax) - hb_max (yMin, yMax);
 
-    font->scale_glyph_extents (extents);
+    if (scaled)
+      font->scale_glyph_extents (extents);
 
     return true;
   }
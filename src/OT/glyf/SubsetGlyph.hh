@@ -21,18 +21,10 @@ struct SubsetGlyph
 
   bool serialize (hb_serialize_context_t *c,
 		  bool use_short_loca,
-		  const hb_subset_plan_t *plan,
-		  hb_font_t *font)
+		  const hb_subset_plan_t *plan)
   {
     TRACE_SERIALIZE (this);
 
-    if (font)
-    {
-      const OT::glyf_accelerator_t &glyf = *font->face->table.glyf;
-      if (!this->compile_bytes_with_deltas (plan, font, glyf))
-        return_trace (false);
-    }
-
     hb_bytes_t dest_glyph = dest_start.copy (c);
     dest_glyph = hb_bytes_t (&dest_glyph, dest_glyph.length + dest_end.copy (c).length);
     unsigned int pad_length = use_short_loca ? padding () : 0;
@@ -67,8 +59,14 @@ struct SubsetGlyph
 
   bool compile_bytes_with_deltas (const hb_subset_plan_t *plan,
                                   hb_font_t *font,
-                                  const glyf_accelerator_t &glyf)
-  { return source_glyph.compile_bytes_with_deltas (plan, font, glyf, dest_start, dest_end); }
+                                  const glyf_accelerator_t &glyf,
+                                  contour_point_vector_t &all_points, /* scratch */
+                                  contour_point_vector_t &deltas /* scratch */)
+  {
+    return source_glyph.compile_bytes_with_deltas (plan, font, glyf,
+                                                   all_points, deltas,
+                                                   dest_start, dest_end);
+  }
 
   void free_compiled_bytes ()
   {
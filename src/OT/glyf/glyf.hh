@@ -43,14 +43,13 @@ struct glyf
   bool serialize (hb_serialize_context_t *c,
 		  Iterator it,
                   bool use_short_loca,
-		  const hb_subset_plan_t *plan,
-		  hb_font_t *font)
+		  const hb_subset_plan_t *plan)
   {
     TRACE_SERIALIZE (this);
 
     unsigned init_len = c->length ();
     for (auto &_ : it)
-      if (unlikely (!_.serialize (c, use_short_loca, plan, font)))
+      if (unlikely (!_.serialize (c, use_short_loca, plan)))
         return false;
 
     /* As a special case when all glyph in the font are empty, add a zero byte
@@ -79,11 +78,17 @@ struct glyf
     hb_vector_t<glyf_impl::SubsetGlyph> glyphs;
     _populate_subset_glyphs (c->plan, glyphs);
 
-    hb_font_t *font = nullptr;
+    /* When instancing, compile all glyphs up front so that the loca format
+     * below is chosen from the final glyph sizes. */
+    bool compiled = false;
     if (!c->plan->pinned_at_default)
     {
-      font = _create_font_for_instancing (c->plan);
+      hb_font_t *font = _create_font_for_instancing (c->plan);
       if (unlikely (!font)) return false;
+
+      compiled = _compile_subset_glyphs (c->plan, font, glyphs);
+      hb_font_destroy (font);
+      if (unlikely (!compiled)) return_trace (false);
     }
 
     auto padded_offsets =
@@ -98,7 +103,7 @@ struct glyf
       use_short_loca = max_offset < 0x1FFFF;
     }
 
-    glyf_prime->serialize (c->serializer, glyphs.writer (), use_short_loca, c->plan, font);
+    glyf_prime->serialize (c->serializer, glyphs.writer (), use_short_loca, c->plan);
     if (!use_short_loca) {
       padded_offsets =
           + hb_iter (glyphs)
@@ -106,16 +111,17 @@ struct glyf
           ;
     }
 
-    if (font)
-    {
-      _free_compiled_subset_glyphs (&glyphs);
-      hb_font_destroy (font);
-    }
+    bool result = !c->serializer->in_error () &&
+		  c->serializer->check_success (glyf_impl::_add_loca_and_head (c->plan,
+									      padded_offsets,
+									      use_short_loca));
 
-    if (unlikely (c->serializer->in_error ())) return_trace (false);
-    return_trace (c->serializer->check_success (glyf_impl::_add_loca_and_head (c->plan,
-									       padded_offsets,
-									       use_short_loca)));
+    /* padded_offsets reads the compiled glyph lengths, free them only after
+     * loca is written. */
+    if (compiled)
+      _free_compiled_subset_glyphs (glyphs, glyphs.length);
+
+    return_trace (result);
   }
 
   void
@@ -125,9 +131,16 @@ struct glyf
   hb_font_t *
   _create_font_for_instancing (const hb_subset_plan_t *plan) const;
 
-  void _free_compiled_subset_glyphs (hb_vector_t<glyf_impl::SubsetGlyph> *glyphs) const
+  bool
+  _compile_subset_glyphs (const hb_subset_plan_t *plan,
+			  hb_font_t *font,
+			  hb_vector_t<glyf_impl::SubsetGlyph> &glyphs /* IN/OUT */) const;
+
+  /* Frees the compiled bytes of the first count glyphs. */
+  void _free_compiled_subset_glyphs (hb_vector_t<glyf_impl::SubsetGlyph> &glyphs,
+				     unsigned count) const
   {
-    for (auto _ : *glyphs)
+    for (auto &_ : glyphs.as_array ().sub_array (0, count))
       _.free_compiled_bytes ();
   }
 
@@ -183,7 +196,8 @@ struct glyf_accelerator_t
 
   protected:
   template<typename T>
-  bool get_points (hb_font_t *font, hb_codepoint_t gid, T consumer) const
+  bool get_points (hb_font_t *font, hb_codepoint_t gid, T consumer,
+		   const gvar_accelerator_t::cache_t *gvar_cache = nullptr) const
   {
     if (gid >= num_glyphs) return false;
 
@@ -194,7 +208,8 @@ struct glyf_accelerator_t
     contour_point_vector_t all_points;
 
     bool phantom_only = !consumer.is_consuming_contour_points ();
-    if (unlikely (!glyph_for_gid (gid).get_points (font, *this, all_points, nullptr, true, true, phantom_only)))
+    if (unlikely (!glyph_for_gid (gid).get_points (font, *this, all_points, nullptr, true, true, phantom_only,
+						   hb_array_t<int> (), 0, gvar_cache)))
       return false;
 
     if (consumer.is_consuming_contour_points ())
@@ -322,15 +337,17 @@ struct glyf_accelerator_t
 #endif
 
   public:
-  bool get_extents (hb_font_t *font, hb_codepoint_t gid, hb_glyph_extents_t *extents) const
+  bool get_extents (hb_font_t *font, hb_codepoint_t gid, hb_glyph_extents_t *extents,
+		    const gvar_accelerator_t::cache_t *gvar_cache = nullptr,
+		    bool scaled = true) const
   {
     if (unlikely (gid >= num_glyphs)) return false;
 
 #ifndef HB_NO_VAR
     if (font->num_coords)
-      return get_points (font, gid, points_aggregator_t (font, extents, nullptr, true));
+      return get_points (font, gid, points_aggregator_t (font, extents, nullptr, scaled), gvar_cache);
 #endif
-    return glyph_for_gid (gid).get_extents_without_var_scaled (font, *this, extents);
+    return glyph_for_gid (gid).get_extents_without_var_scaled (font, *this, extents, scaled);
   }
 
   bool paint_glyph (hb_font_t *font, hb_codepoint_t gid, hb_paint_funcs_t *funcs, void *data, hb_color_t foreground) const
@@ -371,8 +388,9 @@ struct glyf_accelerator_t
   }
 
   bool
-  get_path (hb_font_t *font, hb_codepoint_t gid, hb_draw_session_t &draw_session) const
-  { return get_points (font, gid, glyf_impl::path_builder_t (font, draw_session)); }
+  get_path (hb_font_t *font, hb_codepoint_t gid, hb_draw_session_t &draw_session,
+	    const gvar_accelerator_t::cache_t *gvar_cache = nullptr) const
+  { return get_points (font, gid, glyf_impl::path_builder_t (font, draw_session), gvar_cache); }
 
 #ifndef HB_NO_VAR
   const gvar_accelerator_t *gvar;
@@ -422,6 +440,29 @@ glyf::_populate_subset_glyphs (const hb_subset_plan_t   *plan,
   }
 }
 
+/* Applies variation deltas to all glyphs, recomputing their bounding boxes
+ * and metrics. The point buffers are reused across glyphs. On failure the
+ * glyphs compiled so far are freed. */
+inline bool
+glyf::_compile_subset_glyphs (const hb_subset_plan_t *plan,
+			      hb_font_t *font,
+			      hb_vector_t<glyf_impl::SubsetGlyph> &glyphs /* IN/OUT */) const
+{
+  const OT::glyf_accelerator_t &glyf = *font->face->table.glyf;
+  contour_point_vector_t all_points, deltas;
+
+  for (unsigned i = 0; i < glyphs.length; i++)
+  {
+    if (unlikely (!glyphs.arrayZ[i].compile_bytes_with_deltas (plan, font, glyf,
+							       all_points, deltas)))
+    {
+      _free_compiled_subset_glyphs (glyphs, i);
+      return false;
+    }
+  }
+  return true;
+}
+
 inline hb_font_t *
 glyf::_create_font_for_instancing (const hb_subset_plan_t *plan) const
 {
@@ -39,6 +39,19 @@ namespace graph {
  */
 struct graph_t
 {
+  /*
+   * Counters describing the work done by the repacker on this graph,
+   * used for debugging and benchmarking.
+   */
+  struct stats_t
+  {
+    unsigned sorts = 0;
+    unsigned full_distance_updates = 0;
+    unsigned incremental_distance_updates = 0;
+    unsigned distance_updated_vertices = 0;
+    unsigned resolution_rounds = 0;
+  };
+
   struct vertex_t
   {
     hb_serialize_context_t::object_t obj;
@@ -415,6 +428,18 @@ struct graph_t
     link->objidx = child_id;
     link->position = (char*) offset - (char*) v.obj.head;
     vertices_[child_id].parents.push (parent_id);
+    distance_dirty_.add (child_id);
+  }
+
+  /*
+   * Forces the next distance update to recompute the distances of all
+   * vertices. Must be called after the graph's links have been modified
+   * directly, without going through graph_t methods.
+   */
+  void invalidate_distances ()
+  {
+    distance_invalid = true;
+    positions_invalid = true;
   }
 
   /*
@@ -441,6 +466,7 @@ struct graph_t
       return;
     }
 
+    stats.sorts++;
     update_distances ();
 
     hb_priority_queue_t queue;
@@ -802,7 +828,6 @@ struct graph_t
                    unsigned new_parent_idx,
                    const O* new_offset)
   {
-    distance_invalid = true;
     positions_invalid = true;
 
     auto& old_v = vertices_[old_parent_idx];
@@ -818,6 +843,7 @@ struct graph_t
 
     auto& child = vertices_[child_id];
     child.parents.push (new_parent_idx);
+    distance_dirty_.add (child_id);
 
     old_v.remove_real_link (child_id, old_offset);
     child.remove_parent (old_parent_idx);
@@ -845,7 +871,6 @@ struct graph_t
   unsigned duplicate (unsigned node_idx)
   {
     positions_invalid = true;
-    distance_invalid = true;
 
     auto* clone = vertices_.push ();
     auto& child = vertices_[node_idx];
@@ -883,6 +908,8 @@ struct graph_t
     for (const auto& l : root ().obj.all_links ())
       vertices_[l.objidx].remap_parent (root_idx () - 1, root_idx ());
 
+    distance_dirty_.add (clone_idx);
+
     return clone_idx;
   }
 
@@ -950,7 +977,6 @@ struct graph_t
   unsigned new_node (char* head, char* tail)
   {
     positions_invalid = true;
-    distance_invalid = true;
 
     auto* clone = vertices_.push ();
     if (vertices_.in_error ()) {
@@ -973,6 +999,8 @@ struct graph_t
     for (const auto& l : root ().obj.all_links ())
       vertices_[l.objidx].remap_parent (root_idx () - 1, root_idx ());
 
+    distance_dirty_.add (clone_idx);
+
     return clone_idx;
   }
 
@@ -1009,14 +1037,24 @@ struct graph_t
     return true;
   }
 
-#if 0
+#ifdef HB_REPACKER_DUMP_GRAPHS
   /*
    * Saves the current graph to a packed binary format which the repacker fuzzer takes
-   * as a seed.
+   * as a seed, and perf/benchmark-repacker loads. Only real links are saved. Returns
+   * false if the graph is too large to be represented in that format.
    */
-  void save_fuzzer_seed (hb_tag_t tag) const
+  bool save_fuzzer_seed (hb_tag_t tag, FILE* f) const
   {
-    FILE* f = fopen ("./repacker_fuzzer_seed", "w");
+    if (vertices_.length > 0xFFFF) return false;
+
+    unsigned total_links = 0;
+    for (const auto& v : vertices_)
+    {
+      if (v.table_size () > 0xFFFF) return false;
+      total_links += v.obj.real_links.length;
+    }
+    if (total_links > 0xFFFF) return false;
+
     fwrite ((void*) &tag, sizeof (tag), 1, f);
 
     uint16_t num_objects = vertices_.length;
@@ -1029,10 +1067,7 @@ struct graph_t
       fwrite ((const void*) v.obj.head, blob_size, 1, f);
     }
 
-    uint16_t link_count = 0;
-    for (const auto& v : vertices_)
-      link_count += v.obj.real_links.length;
-
+    uint16_t link_count = total_links;
     fwrite ((void*) &link_count, sizeof (link_count), 1, f);
 
     typedef struct
@@ -1055,7 +1090,7 @@ struct graph_t
       }
     }
 
-    fclose (f);
+    return true;
   }
 #endif
 
@@ -1099,7 +1134,7 @@ struct graph_t
       num_roots_for_space_[node.space] = num_roots_for_space_[node.space] - 1;
       num_roots_for_space_[new_space] = num_roots_for_space_[new_space] + 1;
       node.space = new_space;
-      distance_invalid = true;
+      distance_dirty_.add (index);
       positions_invalid = true;
     }
   }
@@ -1220,7 +1255,14 @@ struct graph_t
    */
   void update_distances ()
   {
-    if (!distance_invalid) return;
+    if (!distance_invalid)
+    {
+      update_dirty_distances ();
+      return;
+    }
+
+    stats.full_distance_updates++;
+    distance_dirty_.clear ();
 
     // Uses Dijkstra's algorithm to find all of the shortest distances.
     // https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm
@@ -1258,11 +1300,7 @@ struct graph_t
       {
         if (visited[link.objidx]) continue;
 
-        const auto& child = vertices_[link.objidx].obj;
-        unsigned link_width = link.width ? link.width : 4; // treat virtual offsets as 32 bits wide
-        int64_t child_weight = (child.tail - child.head) +
-                               ((int64_t) 1 << (link_width * 8)) * (vertices_[link.objidx].space + 1);
-        int64_t child_distance = next_distance + child_weight;
+        int64_t child_distance = next_distance + link_weight (link);
 
         if (child_distance < vertices_[link.objidx].distance)
         {
@@ -1282,7 +1320,109 @@ struct graph_t
     distance_invalid = false;
   }
 
+  /*
+   * Recomputes distances for only the vertices whose incoming links or space
+   * changed since the last distance update, along with everything reachable
+   * from them. All other distances can't have changed since the distance
+   * of a vertex only depends on its ancestors.
+   */
+  void update_dirty_distances ()
+  {
+    if (!distance_dirty_) return;
+
+    update_parents ();
+
+    hb_set_t affected;
+    for (unsigned idx : distance_dirty_)
+    {
+      if (idx >= vertices_.length) continue;
+      find_subgraph (idx, affected);
+    }
+    distance_dirty_.clear ();
+
+    if (unlikely (!check_success (!affected.in_error ()))) return;
+
+    if (affected.get_population () * 2 > vertices_.length)
+    {
+      // Most of the graph is affected, a full update is cheaper.
+      distance_invalid = true;
+      update_distances ();
+      return;
+    }
+
+    stats.incremental_distance_updates++;
+    stats.distance_updated_vertices += affected.get_population ();
+
+    for (unsigned idx : affected)
+      vertices_[idx].distance = hb_int_max (int64_t);
+
+    // Seed the search with the shortest path into each affected vertex coming
+    // from the unaffected part of the graph, whose distances are still valid.
+    hb_priority_queue_t queue;
+    for (unsigned idx : affected)
+    {
+      auto& v = vertices_[idx];
+      if (idx == root_idx ())
+        v.distance = 0;
+
+      for (unsigned p : v.parents)
+      {
+        if (affected.has (p)) continue;
+        const auto& parent = vertices_[p];
+        if (parent.distance == hb_int_max (int64_t)) continue;
+        for (const auto& link : parent.obj.all_links ())
+        {
+          if (link.objidx != idx) continue;
+          v.distance = hb_min (v.distance, parent.distance + link_weight (link));
+        }
+      }
+
+      if (v.distance != hb_int_max (int64_t))
+        queue.insert (v.distance, idx);
+    }
+
+    hb_set_t visited;
+    while (!queue.in_error () && !queue.is_empty ())
+    {
+      auto entry = queue.pop_minimum ();
+      unsigned next_idx = entry.second;
+      const auto& next = vertices_[next_idx];
+      if (visited.has (next_idx) || entry.first != next.distance) continue;
+      visited.add (next_idx);
+
+      // All children of an affected vertex are also affected.
+      for (const auto& link : next.obj.all_links ())
+      {
+        if (visited.has (link.objidx)) continue;
+
+        int64_t child_distance = next.distance + link_weight (link);
+        if (child_distance < vertices_[link.objidx].distance)
+        {
+          vertices_[link.objidx].distance = child_distance;
+          queue.insert (child_distance, link.objidx);
+        }
+      }
+    }
+
+    check_success (!queue.in_error ());
+    check_success (!visited.in_error ());
+  }
+
  private:
+  /*
+   * Returns the weight of an edge for the purposes of computing distances,
+   * this is the size of the child plus a penalty for the width of the offset
+   * and the child's space.
+   */
+  int64_t link_weight (const hb_serialize_context_t::object_t::link_t& link) const
+  {
+    const auto& child = vertices_[link.objidx];
+    unsigned link_width = link.width ? link.width : 4; // treat virtual offsets as 32 bits wide
+    return (int64_t) child.table_size () +
+           ((int64_t) 1 << (link_width * 8)) * (child.space + 1);
+  }
+
+
   /*
    * Updates a link in the graph to point to a different object. Corrects the
    * parents vector on the previous and new child nodes.
@@ -1295,6 +1435,8 @@ struct graph_t
     link.objidx = new_idx;
     vertices_[old_idx].remove_parent (parent_idx);
     vertices_[new_idx].parents.push (parent_idx);
+    distance_dirty_.add (old_idx);
+    distance_dirty_.add (new_idx);
   }
 
   /*
@@ -1378,6 +1520,9 @@ struct graph_t
   bool successful;
   hb_vector_t<unsigned> num_roots_for_space_;
   hb_vector_t<char*> buffers;
+  hb_set_t distance_dirty_;
+ public:
+  stats_t stats;
 };
 
 }
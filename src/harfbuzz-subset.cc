@@ -43,6 +43,7 @@
 #include "hb-ot-var.cc"
 #include "hb-paint-extents.cc"
 #include "hb-paint.cc"
+#include "hb-raster.cc"
 #include "hb-set.cc"
 #include "hb-shape-plan.cc"
 #include "hb-shape.cc"
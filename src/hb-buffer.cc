@@ -28,6 +28,8 @@
  */
 
 #include "hb-buffer.hh"
+#include "hb-draw.hh"
+#include "hb-map.hh"
 #include "hb-utf.hh"
 
 
@@ -1722,10 +1724,31 @@ hb_buffer_add_utf (hb_buffer_t  *buffer,
   const T *end = next + item_length;
   while (next < end)
   {
-    hb_codepoint_t u;
-    const T *old_next = next;
-    next = utf_t::next (next, end, &u, replacement);
-    buffer->add (u, old_next - (const T *) text);
+    /* Every code unit decodes to at most one character, so decode as
+     * many code units as there is room for straight into info[], with
+     * no per-character ensure(). */
+    if (unlikely (!buffer->ensure (buffer->len + hb_max (1u, (unsigned) (end - next) * sizeof (T) / 4))))
+    {
+      next = end;
+      break;
+    }
+    unsigned int room = buffer->allocated - 1 - buffer->len;
+    const T *chunk_end = (unsigned) (end - next) > room ? next + room : end;
+
+    hb_glyph_info_t *info = buffer->info + buffer->len;
+    hb_glyph_info_t *info_start = info;
+    while (next < chunk_end)
+    {
+      hb_codepoint_t u;
+      const T *old_next = next;
+      next = utf_t::next (next, end, &u, replacement);
+
+      hb_memset (info, 0, sizeof (*info));
+      info->codepoint = u;
+      info->cluster = old_next - (const T *) text;
+      info++;
+    }
+    buffer->len += info - info_start;
   }
 
   /* Add post-context */
@@ -2061,6 +2084,164 @@ hb_buffer_t::sort (unsigned int start, unsigned int end, int(*compar)(const hb_g
 }
 
 
+#ifndef HB_NO_DRAW
+/*
+ * Drawing.
+ */
+
+/* Where the path of one glyph is kept while drawing a buffer. */
+struct hb_buffer_glyph_path_t
+{
+  unsigned verbs_start;
+  unsigned verbs_length;
+  unsigned coords_start;
+  unsigned coords_length;
+};
+
+static bool
+_hb_buffer_record_glyph_path (hb_font_t               *font,
+			      hb_codepoint_t           glyph,
+			      hb_vector_t<uint8_t>    &verbs,
+			      hb_vector_t<float>      &coords,
+			      hb_buffer_glyph_path_t  &path)
+{
+  path.verbs_start = verbs.length;
+  path.coords_start = coords.length;
+
+  /* Most glyphs fit in the first try; for the rest, the first try
+   * tells how much room they need. */
+  unsigned verbs_length = 64;
+  unsigned coords_length = 256;
+  bool fits = false;
+  while (!fits)
+  {
+    if (unlikely (!verbs.resize (path.verbs_start + verbs_length, false) ||
+		  !coords.resize (path.coords_start + coords_length, false)))
+      return false;
+    fits = hb_font_get_glyph_path (font, glyph, HB_DRAW_PATH_FLAG_DEFAULT,
+				   &verbs_length, verbs.arrayZ + path.verbs_start,
+				   &coords_length, coords.arrayZ + path.coords_start);
+  }
+  verbs.resize (path.verbs_start + verbs_length, false);
+  coords.resize (path.coords_start + coords_length, false);
+
+  path.verbs_length = verbs_length;
+  path.coords_length = coords_length;
+  return true;
+}
+
+static void
+_hb_buffer_replay_glyph_path (const hb_buffer_glyph_path_t &path,
+			      const uint8_t                *verbs,
+			      const float                  *coords,
+			      float x, float y,
+			      hb_draw_funcs_t              *dfuncs,
+			      void                         *draw_data)
+{
+  hb_draw_session_t draw_session (dfuncs, draw_data);
+  verbs += path.verbs_start;
+  coords += path.coords_start;
+  for (unsigned i = 0; i < path.verbs_length; i++)
+    switch (verbs[i])
+    {
+      case HB_DRAW_VERB_MOVE_TO:
+	draw_session.move_to (x + coords[0], y + coords[1]);
+	coords += 2;
+	break;
+      case HB_DRAW_VERB_LINE_TO:
+	draw_session.line_to (x + coords[0], y + coords[1]);
+	coords += 2;
+	break;
+      case HB_DRAW_VERB_QUADRATIC_TO:
+	draw_session.quadratic_to (x + coords[0], y + coords[1],
+				   x + coords[2], y + coords[3]);
+	coords += 4;
+	break;
+      case HB_DRAW_VERB_CUBIC_TO:
+	draw_session.cubic_to (x + coords[0], y + coords[1],
+			       x + coords[2], y + coords[3],
+			       x + coords[4], y + coords[5]);
+	coords += 6;
+	break;
+      case HB_DRAW_VERB_CLOSE_PATH:
+	draw_session.close_path ();
+	break;
+    }
+}
+
+/**
+ * hb_buffer_draw_glyphs:
+ * @buffer: An #hb_buffer_t, after shaping
+ * @font: The #hb_font_t @buffer was shaped with
+ * @dfuncs: #hb_draw_funcs_t to draw to
+ * @draw_data: User data to pass to draw callbacks
+ *
+ * Draws the outlines of all glyphs in @buffer, each moved to its
+ * position in the shaped run: the first glyph is drawn at the origin,
+ * and every glyph is drawn at the sum of the advances of the glyphs
+ * before it plus its own offsets.  If @buffer has no positions, all
+ * glyphs are drawn at the origin.
+ *
+ * The callbacks receive the same calls as they would from
+ * hb_font_draw_glyph() for each glyph with the coordinates moved, but
+ * each distinct glyph is only fetched from @font once per call, however
+ * often it occurs in @buffer.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_buffer_draw_glyphs (hb_buffer_t     *buffer,
+		       hb_font_t       *font,
+		       hb_draw_funcs_t *dfuncs,
+		       void            *draw_data)
+{
+  if (unlikely (buffer->content_type != HB_BUFFER_CONTENT_TYPE_GLYPHS))
+    return;
+
+  hb_hashmap_t<hb_codepoint_t, unsigned> glyphs;
+  hb_vector_t<hb_buffer_glyph_path_t> paths;
+  hb_vector_t<uint8_t> verbs;
+  hb_vector_t<float> coords;
+
+  const hb_glyph_info_t *info = buffer->info;
+  const hb_glyph_position_t *pos = buffer->have_positions ? buffer->pos : nullptr;
+  hb_position_t x = 0, y = 0;
+  unsigned count = buffer->len;
+  for (unsigned i = 0; i < count; i++)
+  {
+    hb_codepoint_t glyph = info[i].codepoint;
+
+    unsigned *index;
+    unsigned path_index;
+    if (glyphs.has (glyph, &index))
+      path_index = *index;
+    else
+    {
+      hb_buffer_glyph_path_t path;
+      path_index = paths.length;
+      if (unlikely (!_hb_buffer_record_glyph_path (font, glyph, verbs, coords, path)))
+	return;
+      paths.push (path);
+      if (unlikely (paths.in_error () || !glyphs.set (glyph, path_index)))
+	return;
+    }
+
+    if (pos)
+    {
+      _hb_buffer_replay_glyph_path (paths.arrayZ[path_index], verbs.arrayZ, coords.arrayZ,
+				    x + pos[i].x_offset, y + pos[i].y_offset,
+				    dfuncs, draw_data);
+      x += pos[i].x_advance;
+      y += pos[i].y_advance;
+    }
+    else
+      _hb_buffer_replay_glyph_path (paths.arrayZ[path_index], verbs.arrayZ, coords.arrayZ,
+				    0, 0, dfuncs, draw_data);
+  }
+}
+#endif
+
+
 /*
  * Comparing buffers.
  */
@@ -586,6 +586,12 @@ hb_buffer_has_positions (hb_buffer_t  *buffer);
 HB_EXTERN void
 hb_buffer_normalize_glyphs (hb_buffer_t *buffer);
 
+HB_EXTERN void
+hb_buffer_draw_glyphs (hb_buffer_t     *buffer,
+		       hb_font_t       *font,
+		       hb_draw_funcs_t *dfuncs,
+		       void            *draw_data);
+
 
 /*
  * Serialize
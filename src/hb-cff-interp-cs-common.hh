@@ -902,6 +902,316 @@ struct cs_interpreter_t : interpreter_t<ENV>
   typedef interpreter_t<ENV> SUPER;
 };
 
+/* A charstring compiled into a flat list of path commands in font units,
+ * with subroutine calls, hints and blends already resolved.  Also holds
+ * the bounds the extents interpreter would compute for it.  Compiled
+ * glyphs are reference-counted, so that they can be used outside of the
+ * cache lock while another thread evicts them. */
+struct cs_compiled_glyph_t
+{
+  enum verb_t : uint8_t { MOVE_TO, LINE_TO, CUBIC_TO, END_PATH };
+
+  static cs_compiled_glyph_t *create ()
+  {
+    cs_compiled_glyph_t *compiled = (cs_compiled_glyph_t *) hb_malloc (sizeof (cs_compiled_glyph_t));
+    if (unlikely (!compiled))
+      return nullptr;
+    compiled->ref_count.set_relaxed (1);
+    compiled->verbs.init ();
+    compiled->points.init ();
+    compiled->min.set_int (INT_MAX, INT_MAX);
+    compiled->max.set_int (INT_MIN, INT_MIN);
+    return compiled;
+  }
+
+  cs_compiled_glyph_t *reference ()
+  {
+    ref_count.inc ();
+    return this;
+  }
+
+  void destroy ()
+  {
+    if (ref_count.dec () != 1)
+      return;
+    verbs.fini ();
+    points.fini ();
+    hb_free (this);
+  }
+
+  bool in_error () const { return verbs.in_error () || points.in_error (); }
+
+  unsigned get_size () const
+  { return sizeof (*this) + verbs.length + points.length * sizeof (point_t); }
+
+  void move_to (const point_t &p) { verbs.push (MOVE_TO); points.push (p); }
+  void line_to (const point_t &p) { verbs.push (LINE_TO); points.push (p); }
+  void cubic_to (const point_t &p1, const point_t &p2, const point_t &p3)
+  {
+    verbs.push (CUBIC_TO);
+    points.push (p1);
+    points.push (p2);
+    points.push (p3);
+  }
+  void end_path () { verbs.push (END_PATH); }
+
+  /* Computes the bounds the same way the extents path procs do. */
+  void update_bounds ()
+  {
+    min.set_int (INT_MAX, INT_MAX);
+    max.set_int (INT_MIN, INT_MIN);
+
+    point_t pt;
+    bool path_open = false;
+    const point_t *p = points.arrayZ;
+    for (uint8_t verb : verbs)
+    {
+      switch (verb)
+      {
+      case MOVE_TO:
+	path_open = false;
+	pt = *p++;
+	break;
+      case LINE_TO:
+	if (!path_open) { path_open = true; update_bounds (pt); }
+	pt = *p++;
+	update_bounds (pt);
+	break;
+      case CUBIC_TO:
+	if (!path_open) { path_open = true; update_bounds (pt); }
+	update_bounds (p[0]);
+	update_bounds (p[1]);
+	pt = p[2];
+	update_bounds (pt);
+	p += 3;
+	break;
+      case END_PATH:
+	break;
+      }
+    }
+  }
+
+  template <typename PARAM>
+  void replay (PARAM &param) const
+  {
+    const point_t *p = points.arrayZ;
+    for (uint8_t verb : verbs)
+    {
+      switch (verb)
+      {
+      case MOVE_TO:  param.move_to (*p++); break;
+      case LINE_TO:  param.line_to (*p++); break;
+      case CUBIC_TO: param.cubic_to (p[0], p[1], p[2]); p += 3; break;
+      case END_PATH: param.end_path (); break;
+      }
+    }
+  }
+
+  hb_atomic_int_t ref_count;
+  hb_vector_t<uint8_t> verbs;
+  hb_vector_t<point_t> points;
+  point_t min;
+  point_t max;
+
+  private:
+  void update_bounds (const point_t &pt)
+  {
+    if (pt.x < min.x) min.x = pt.x;
+    if (pt.x > max.x) max.x = pt.x;
+    if (pt.y < min.y) min.y = pt.y;
+    if (pt.y > max.y) max.y = pt.y;
+  }
+};
+
+/* Per-face cache of compiled charstrings, shared by extents and drawing.
+ * Glyphs are keyed by the variation coords they were compiled at, so
+ * fonts at a few different coords can share the cache without dropping
+ * each other's entries.  When adding a glyph would go over the size
+ * limit, or need one coords set too many, all entries are dropped.
+ * Disabled while the size limit is zero.
+ *
+ * The lock is only held to look up and insert entries.  Compiling runs
+ * the charstring interpreter outside of it, and callers use a compiled
+ * glyph through their own reference after the lock is dropped, so draw
+ * callbacks may call back into the face. */
+struct cs_charstring_cache_t
+{
+  void init ()
+  {
+    lock.init ();
+    max_size.set_relaxed (0);
+    size = 0;
+    hits = misses = 0;
+    instances.init ();
+  }
+
+  void fini ()
+  {
+    clear ();
+    instances.fini ();
+    lock.fini ();
+  }
+
+  void set_max_size (unsigned max_size_)
+  {
+    hb_lock_t l (lock);
+    max_size.set_relaxed (max_size_);
+    if (size > max_size_)
+      clear ();
+  }
+
+  void get_stats (unsigned *hits_, unsigned *misses_, unsigned *size_)
+  {
+    hb_lock_t l (lock);
+    if (hits_) *hits_ += hits;
+    if (misses_) *misses_ += misses;
+    if (size_) *size_ += size;
+  }
+
+  /* Calls use() on glyph compiled at coords, compiling it with compile()
+   * first if needed.  Returns false if the cache is disabled or compiling
+   * failed, in which case use() was not called. */
+  template <typename Compile, typename Use>
+  bool with_glyph (hb_codepoint_t glyph,
+		   const int *coords, unsigned num_coords,
+		   Compile compile, Use use)
+  {
+    if (!max_size.get_relaxed ())
+      return false;
+
+    cs_compiled_glyph_t *compiled = get (glyph, coords, num_coords);
+    if (compiled)
+    {
+      use (*compiled);
+      compiled->destroy ();
+      return true;
+    }
+
+    compiled = cs_compiled_glyph_t::create ();
+    if (unlikely (!compiled))
+      return false;
+    if (unlikely (!compile (*compiled) || compiled->in_error ()))
+    {
+      compiled->destroy ();
+      return false;
+    }
+
+    add (glyph, coords, num_coords, compiled);
+
+    use (*compiled);
+    compiled->destroy ();
+    return true;
+  }
+
+  private:
+  /* Coords sets kept at once; lookups scan them linearly. */
+  enum { MAX_INSTANCES = 8 };
+
+  struct instance_t
+  {
+    hb_vector_t<int> coords;
+    hb_hashmap_t<hb_codepoint_t, cs_compiled_glyph_t *> glyphs;
+  };
+
+  instance_t *find_instance (const int *coords, unsigned num_coords)
+  {
+    for (instance_t *instance : instances)
+      if (instance->coords.length == num_coords &&
+	  !hb_memcmp (instance->coords.arrayZ, coords, num_coords * sizeof (int)))
+	return instance;
+    return nullptr;
+  }
+
+  /* Returns a reference to glyph compiled at coords, or nullptr. */
+  cs_compiled_glyph_t *get (hb_codepoint_t glyph,
+			    const int *coords, unsigned num_coords)
+  {
+    hb_lock_t l (lock);
+
+    instance_t *instance = find_instance (coords, num_coords);
+    cs_compiled_glyph_t **entry;
+    if (instance && instance->glyphs.has (glyph, &entry))
+    {
+      hits++;
+      return (*entry)->reference ();
+    }
+    misses++;
+    return nullptr;
+  }
+
+  void add (hb_codepoint_t glyph,
+	    const int *coords, unsigned num_coords,
+	    cs_compiled_glyph_t *compiled)
+  {
+    hb_lock_t l (lock);
+
+    unsigned glyph_size = compiled->get_size ();
+    unsigned limit = max_size.get_relaxed ();
+    instance_t *instance = find_instance (coords, num_coords);
+    unsigned instance_size = instance ? 0 : sizeof (instance_t) + num_coords * sizeof (int);
+    if (glyph_size + instance_size > limit)
+      return;
+    if (size + glyph_size + instance_size > limit ||
+	(!instance && instances.length >= MAX_INSTANCES))
+    {
+      clear ();
+      instance = nullptr;
+    }
+
+    if (!instance)
+    {
+      instance = (instance_t *) hb_calloc (1, sizeof (instance_t));
+      if (unlikely (!instance))
+	return;
+      instance->coords.init ();
+      instance->glyphs.init ();
+      instance->coords.resize (num_coords);
+      instances.push (instance);
+      if (unlikely (instance->coords.in_error () || instances.in_error ()))
+      {
+	if (!instances.in_error ())
+	  instances.pop ();
+	destroy_instance (instance);
+	return;
+      }
+      hb_memcpy (instance->coords.arrayZ, coords, num_coords * sizeof (int));
+      size += instance_size;
+    }
+
+    /* Another thread may have added the glyph meanwhile; keep theirs. */
+    if (instance->glyphs.has (glyph))
+      return;
+    if (unlikely (!instance->glyphs.set (glyph, compiled)))
+      return;
+    compiled->reference ();
+    size += glyph_size;
+  }
+
+  static void destroy_instance (instance_t *instance)
+  {
+    for (cs_compiled_glyph_t *compiled : instance->glyphs.values ())
+      compiled->destroy ();
+    instance->glyphs.fini ();
+    instance->coords.fini ();
+    hb_free (instance);
+  }
+
+  void clear ()
+  {
+    for (instance_t *instance : instances)
+      destroy_instance (instance);
+    instances.resize (0);
+    size = 0;
+  }
+
+  hb_mutex_t lock;
+  hb_atomic_int_t max_size;
+  unsigned size;
+  unsigned hits;
+  unsigned misses;
+  hb_vector_t<instance_t *> instances;
+};
+
 } /* namespace CFF */
 
 #endif /* HB_CFF_INTERP_CS_COMMON_HH */
@@ -83,6 +83,7 @@
 #define HB_NO_OT_FONT_GLYPH_NAMES
 #define HB_NO_OT_SHAPE_FRACTIONS
 #define HB_NO_PAINT
+#define HB_NO_RASTER
 #define HB_NO_SETLOCALE
 #define HB_NO_STYLE
 #define HB_NO_SUBSET_LAYOUT
@@ -130,6 +131,10 @@
 #define HB_NO_OT_FONT_BITMAP
 #endif
 
+#ifdef HB_NO_DRAW
+#define HB_NO_RASTER
+#endif
+
 #ifdef HB_NO_CFF
 #define HB_NO_OT_FONT_CFF
 #define HB_NO_SUBSET_CFF
@@ -72,6 +72,45 @@ typedef struct hb_draw_state_t {
  */
 #define HB_DRAW_STATE_DEFAULT {0, 0.f, 0.f, 0.f, 0.f, {0.}, {0.}, {0.}}
 
+/**
+ * hb_draw_verb_t:
+ * @HB_DRAW_VERB_MOVE_TO: Start a new contour at one point
+ * @HB_DRAW_VERB_LINE_TO: Line to one point
+ * @HB_DRAW_VERB_QUADRATIC_TO: Quadratic Bézier curve through one control
+ *   point to an end point
+ * @HB_DRAW_VERB_CUBIC_TO: Cubic Bézier curve through two control points to
+ *   an end point
+ * @HB_DRAW_VERB_CLOSE_PATH: Close the current contour; takes no points
+ *
+ * The verbs of a glyph path fetched with hb_font_get_glyph_path().  Each
+ * verb consumes the number of points listed above from the path's
+ * coordinate array.
+ *
+ * Since: REPLACEME
+ **/
+typedef enum {
+  HB_DRAW_VERB_MOVE_TO,
+  HB_DRAW_VERB_LINE_TO,
+  HB_DRAW_VERB_QUADRATIC_TO,
+  HB_DRAW_VERB_CUBIC_TO,
+  HB_DRAW_VERB_CLOSE_PATH
+} hb_draw_verb_t;
+
+/**
+ * hb_draw_path_flags_t:
+ * @HB_DRAW_PATH_FLAG_DEFAULT: Output the path as drawn by the font
+ * @HB_DRAW_PATH_FLAG_CUBICS_ONLY: Convert quadratic curves to cubic ones,
+ *   so that the path has no #HB_DRAW_VERB_QUADRATIC_TO verbs
+ *
+ * Flags for hb_font_get_glyph_path().
+ *
+ * Since: REPLACEME
+ **/
+typedef enum { /*< flags >*/
+  HB_DRAW_PATH_FLAG_DEFAULT		= 0x00000000u,
+  HB_DRAW_PATH_FLAG_CUBICS_ONLY		= 0x00000001u
+} hb_draw_path_flags_t;
+
 
 /**
  * hb_draw_funcs_t:
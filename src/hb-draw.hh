@@ -40,6 +40,87 @@
   HB_DRAW_FUNC_IMPLEMENT (close_path) \
   /* ^--- Add new callbacks here */
 
+/* Flattened path output for hb_font_get_glyph_path().  Writes as much
+ * of the path as fits in the caller's arrays and counts the rest, so the
+ * caller can retry with larger ones. */
+struct hb_draw_path_t
+{
+  hb_draw_path_t (hb_draw_path_flags_t flags_,
+		  uint8_t *verbs_, unsigned verbs_size_,
+		  float *coords_, unsigned coords_size_)
+    : flags {flags_},
+      verbs {verbs_}, verbs_size {verbs_size_}, verbs_length {0},
+      coords {coords_}, coords_size {coords_size_}, coords_length {0}
+  {}
+
+  bool fits () const
+  { return verbs_length <= verbs_size && coords_length <= coords_size; }
+
+  void add_verb (hb_draw_verb_t verb)
+  {
+    if (likely (verbs_length < verbs_size))
+      verbs[verbs_length] = verb;
+    verbs_length++;
+  }
+  void add_point (float x, float y)
+  {
+    if (likely (coords_length + 2 <= coords_size))
+    {
+      coords[coords_length] = x;
+      coords[coords_length + 1] = y;
+    }
+    coords_length += 2;
+  }
+
+  void move_to (float to_x, float to_y)
+  {
+    add_verb (HB_DRAW_VERB_MOVE_TO);
+    add_point (to_x, to_y);
+  }
+  void line_to (float to_x, float to_y)
+  {
+    add_verb (HB_DRAW_VERB_LINE_TO);
+    add_point (to_x, to_y);
+  }
+  void quadratic_to (const hb_draw_state_t &st,
+		     float control_x, float control_y,
+		     float to_x, float to_y)
+  {
+    if (flags & HB_DRAW_PATH_FLAG_CUBICS_ONLY)
+    {
+      /* Same conversion as hb_draw_quadratic_to_nil(). */
+      const float one_third = 0.33333333f;
+      cubic_to ((st.current_x + 2.f * control_x) * one_third,
+		(st.current_y + 2.f * control_y) * one_third,
+		(to_x + 2.f * control_x) * one_third,
+		(to_y + 2.f * control_y) * one_third,
+		to_x, to_y);
+      return;
+    }
+    add_verb (HB_DRAW_VERB_QUADRATIC_TO);
+    add_point (control_x, control_y);
+    add_point (to_x, to_y);
+  }
+  void cubic_to (float control1_x, float control1_y,
+		 float control2_x, float control2_y,
+		 float to_x, float to_y)
+  {
+    add_verb (HB_DRAW_VERB_CUBIC_TO);
+    add_point (control1_x, control1_y);
+    add_point (control2_x, control2_y);
+    add_point (to_x, to_y);
+  }
+  void close_path () { add_verb (HB_DRAW_VERB_CLOSE_PATH); }
+
+  hb_draw_path_flags_t flags;
+  uint8_t *verbs;
+  unsigned verbs_size;
+  unsigned verbs_length;
+  float *coords;
+  unsigned coords_size;
+  unsigned coords_length;
+};
+
 struct hb_draw_funcs_t
 {
   hb_object_header_t header;
@@ -62,35 +143,79 @@ struct hb_draw_funcs_t
 #undef HB_DRAW_FUNC_IMPLEMENT
   } *destroy;
 
+  /* Set only on the internal funcs used by hb_font_get_glyph_path(), whose
+   * draw_data is an hb_draw_path_t.  Segments are then appended to it
+   * directly, and func is unused. */
+  bool is_path;
+
   void emit_move_to (void *draw_data, hb_draw_state_t &st,
 		     float to_x, float to_y)
-  { func.move_to (this, draw_data, &st,
+  {
+    if (is_path)
+    {
+      ((hb_draw_path_t *) draw_data)->move_to (to_x, to_y);
+      return;
+    }
+    func.move_to (this, draw_data, &st,
 		  to_x, to_y,
-		  !user_data ? nullptr : user_data->move_to); }
+		  !user_data ? nullptr : user_data->move_to);
+  }
   void emit_line_to (void *draw_data, hb_draw_state_t &st,
 		     float to_x, float to_y)
-  { func.line_to (this, draw_data, &st,
+  {
+    if (is_path)
+    {
+      ((hb_draw_path_t *) draw_data)->line_to (to_x, to_y);
+      return;
+    }
+    func.line_to (this, draw_data, &st,
 		  to_x, to_y,
-		  !user_data ? nullptr : user_data->line_to); }
+		  !user_data ? nullptr : user_data->line_to);
+  }
   void emit_quadratic_to (void *draw_data, hb_draw_state_t &st,
 			  float control_x, float control_y,
 			  float to_x, float to_y)
-  { func.quadratic_to (this, draw_data, &st,
+  {
+    if (is_path)
+    {
+      ((hb_draw_path_t *) draw_data)->quadratic_to (st,
+						    control_x, control_y,
+						    to_x, to_y);
+      return;
+    }
+    func.quadratic_to (this, draw_data, &st,
 		       control_x, control_y,
 		       to_x, to_y,
-		       !user_data ? nullptr : user_data->quadratic_to); }
+		       !user_data ? nullptr : user_data->quadratic_to);
+  }
   void emit_cubic_to (void *draw_data, hb_draw_state_t &st,
 		      float control1_x, float control1_y,
 		      float control2_x, float control2_y,
 		      float to_x, float to_y)
-  { func.cubic_to (this, draw_data, &st,
+  {
+    if (is_path)
+    {
+      ((hb_draw_path_t *) draw_data)->cubic_to (control1_x, control1_y,
+						control2_x, control2_y,
+						to_x, to_y);
+      return;
+    }
+    func.cubic_to (this, draw_data, &st,
 		   control1_x, control1_y,
 		   control2_x, control2_y,
 		   to_x, to_y,
-		   !user_data ? nullptr : user_data->cubic_to); }
+		   !user_data ? nullptr : user_data->cubic_to);
+  }
   void emit_close_path (void *draw_data, hb_draw_state_t &st)
-  { func.close_path (this, draw_data, &st,
-		     !user_data ? nullptr : user_data->close_path); }
+  {
+    if (is_path)
+    {
+      ((hb_draw_path_t *) draw_data)->close_path ();
+      return;
+    }
+    func.close_path (this, draw_data, &st,
+		     !user_data ? nullptr : user_data->close_path);
+  }
 
 
   void move_to (void *draw_data, hb_draw_state_t &st,
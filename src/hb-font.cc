@@ -1423,6 +1423,64 @@ hb_font_draw_glyph (hb_font_t *font,
   font->draw_glyph (glyph, dfuncs, draw_data);
 }
 
+static const hb_draw_funcs_t _hb_draw_funcs_path = {
+  HB_OBJECT_HEADER_STATIC,
+
+  {}, nullptr, nullptr,
+
+  true /* is_path */
+};
+
+/**
+ * hb_font_get_glyph_path:
+ * @font: #hb_font_t to work upon
+ * @glyph: The glyph ID
+ * @flags: #hb_draw_path_flags_t controlling the output
+ * @verbs_length: (inout): The size of the @verbs array; on return, the
+ *   number of verbs in the path
+ * @verbs: (out) (array length=verbs_length): Array to store the path's
+ *   #hb_draw_verb_t values in
+ * @coords_length: (inout): The size of the @coords array; on return, the
+ *   number of coordinates in the path
+ * @coords: (out) (array length=coords_length): Array to store the x,y
+ *   coordinates of the path's points in
+ *
+ * Fetches the outline of a glyph in the specified @font as a flat array of
+ * verbs and a flat array of point coordinates, with the same values that
+ * hb_font_draw_glyph() would pass to draw callbacks.  This avoids making
+ * a callback per path segment, which for simple glyphs can cost more than
+ * decoding the outline.
+ *
+ * If either array is too small, it is filled as far as it goes, and
+ * @verbs_length and @coords_length are still set to the sizes needed for
+ * the whole path, so that the call can be repeated with larger arrays.
+ *
+ * Return value: `true` if the whole path fit in the arrays, `false`
+ * otherwise
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_font_get_glyph_path (hb_font_t            *font,
+			hb_codepoint_t        glyph,
+			hb_draw_path_flags_t  flags,
+			unsigned int         *verbs_length, /* IN/OUT */
+			uint8_t              *verbs,        /* OUT */
+			unsigned int         *coords_length, /* IN/OUT */
+			float                *coords        /* OUT */)
+{
+  hb_draw_path_t path (flags,
+		       verbs, *verbs_length,
+		       coords, *coords_length);
+  font->draw_glyph (glyph,
+		    const_cast<hb_draw_funcs_t *> (&_hb_draw_funcs_path),
+		    &path);
+
+  *verbs_length = path.verbs_length;
+  *coords_length = path.coords_length;
+  return path.fits ();
+}
+
 /**
  * hb_font_paint_glyph:
  * @font: #hb_font_t to work upon
@@ -946,6 +946,15 @@ hb_font_draw_glyph (hb_font_t *font,
                     hb_codepoint_t glyph,
                     hb_draw_funcs_t *dfuncs, void *draw_data);
 
+HB_EXTERN hb_bool_t
+hb_font_get_glyph_path (hb_font_t            *font,
+			hb_codepoint_t        glyph,
+			hb_draw_path_flags_t  flags,
+			unsigned int         *verbs_length, /* IN/OUT */
+			uint8_t              *verbs,        /* OUT */
+			unsigned int         *coords_length, /* IN/OUT */
+			float                *coords        /* OUT */);
+
 HB_EXTERN void
 hb_font_paint_glyph (hb_font_t *font,
                      hb_codepoint_t glyph,
@@ -97,6 +97,8 @@ HB_DEFINE_OBJECT_TYPE (font)
 HB_DEFINE_OBJECT_TYPE (font_funcs)
 HB_DEFINE_OBJECT_TYPE (set)
 HB_DEFINE_OBJECT_TYPE (map)
+HB_DEFINE_OBJECT_TYPE (raster)
+HB_DEFINE_OBJECT_TYPE (raster_atlas)
 HB_DEFINE_OBJECT_TYPE (shape_plan)
 HB_DEFINE_OBJECT_TYPE (unicode_funcs)
 HB_DEFINE_VALUE_TYPE (feature)
@@ -106,6 +108,7 @@ HB_DEFINE_VALUE_TYPE (segment_properties)
 HB_DEFINE_VALUE_TYPE (draw_state)
 HB_DEFINE_VALUE_TYPE (color_stop)
 HB_DEFINE_VALUE_TYPE (color_line)
+HB_DEFINE_VALUE_TYPE (raster_atlas_entry)
 HB_DEFINE_VALUE_TYPE (user_data_key)
 
 HB_DEFINE_VALUE_TYPE (ot_var_axis_info)
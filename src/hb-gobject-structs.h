@@ -76,6 +76,14 @@ HB_EXTERN GType
 hb_gobject_map_get_type (void);
 #define HB_GOBJECT_TYPE_MAP (hb_gobject_map_get_type ())
 
+HB_EXTERN GType
+hb_gobject_raster_get_type (void);
+#define HB_GOBJECT_TYPE_RASTER (hb_gobject_raster_get_type ())
+
+HB_EXTERN GType
+hb_gobject_raster_atlas_get_type (void);
+#define HB_GOBJECT_TYPE_RASTER_ATLAS (hb_gobject_raster_atlas_get_type ())
+
 HB_EXTERN GType
 hb_gobject_shape_plan_get_type (void);
 #define HB_GOBJECT_TYPE_SHAPE_PLAN (hb_gobject_shape_plan_get_type ())
@@ -114,6 +122,10 @@ HB_EXTERN GType
 hb_gobject_color_line_get_type (void);
 #define HB_GOBJECT_TYPE_COLOR_LINE (hb_gobject_color_line_get_type ())
 
+HB_EXTERN GType
+hb_gobject_raster_atlas_entry_get_type (void);
+#define HB_GOBJECT_TYPE_RASTER_ATLAS_ENTRY (hb_gobject_raster_atlas_entry_get_type ())
+
 HB_EXTERN GType
 hb_gobject_user_data_key_get_type (void);
 #define HB_GOBJECT_TYPE_USER_DATA_KEY (hb_gobject_user_data_key_get_type ())
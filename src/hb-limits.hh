@@ -97,6 +97,10 @@
 #define HB_CFF_MAX_OPS 10000
 #endif
 
+#ifndef HB_CFF_MAX_FLATTENED_CACHE_SIZE
+#define HB_CFF_MAX_FLATTENED_CACHE_SIZE (32 * 1024 * 1024) /* Bytes. */
+#endif
+
 #ifndef HB_COLRV1_MAX_EDGE_COUNT
 #define HB_COLRV1_MAX_EDGE_COUNT 1024
 #endif
@@ -403,16 +403,28 @@ bool _get_bounds (const OT::cff1::accelerator_t *cff, hb_codepoint_t glyph, boun
   return true;
 }
 
-bool OT::cff1::accelerator_t::get_extents (hb_font_t *font, hb_codepoint_t glyph, hb_glyph_extents_t *extents) const
+static bool _compile (const OT::cff1::accelerator_t *cff, hb_codepoint_t glyph,
+		      cs_compiled_glyph_t &compiled);
+
+bool OT::cff1::accelerator_t::get_extents (hb_font_t *font, hb_codepoint_t glyph, hb_glyph_extents_t *extents, bool scaled) const
 {
 #ifdef HB_NO_OT_FONT_CFF
   /* XXX Remove check when this code moves to .hh file. */
   return true;
 #endif
 
+  if (unlikely (!is_valid () || (glyph >= num_glyphs))) return false;
+
   bounds_t bounds;
 
-  if (!_get_bounds (this, glyph, bounds))
+  if (!charstring_cache.with_glyph (glyph, nullptr, 0,
+				    [&] (cs_compiled_glyph_t &compiled) { return _compile (this, glyph, compiled); },
+				    [&] (const cs_compiled_glyph_t &compiled)
+				    {
+				      bounds.min = compiled.min;
+				      bounds.max = compiled.max;
+				    }) &&
+      !_get_bounds (this, glyph, bounds))
     return false;
 
   if (bounds.min.x >= bounds.max.x)
@@ -436,7 +448,8 @@ bool OT::cff1::accelerator_t::get_extents (hb_font_t *font, hb_codepoint_t glyph
     extents->height = roundf (bounds.min.y.to_real () - extents->y_bearing);
   }
 
-  font->scale_glyph_extents (extents);
+  if (scaled)
+    font->scale_glyph_extents (extents);
 
   return true;
 }
@@ -569,9 +582,156 @@ bool OT::cff1::accelerator_t::get_path (hb_font_t *font, hb_codepoint_t glyph, h
   return true;
 #endif
 
+  if (unlikely (!is_valid () || (glyph >= num_glyphs))) return false;
+
+  if (charstring_cache.with_glyph (glyph, nullptr, 0,
+				   [&] (cs_compiled_glyph_t &compiled) { return _compile (this, glyph, compiled); },
+				   [&] (const cs_compiled_glyph_t &compiled)
+				   {
+				     cff1_path_param_t param (this, font, draw_session, nullptr);
+				     compiled.replay (param);
+				   }))
+    return true;
+
   return _get_path (this, font, glyph, draw_session);
 }
 
+struct cff1_compile_param_t
+{
+  cff1_compile_param_t (const OT::cff1::accelerator_t *cff_,
+			cs_compiled_glyph_t &compiled_, point_t *delta_)
+  {
+    compiled = &compiled_;
+    cff = cff_;
+    delta = delta_;
+  }
+
+  void move_to (const point_t &p)
+  {
+    point_t point = p;
+    if (delta) point.move (*delta);
+    compiled->move_to (point);
+  }
+
+  void line_to (const point_t &p)
+  {
+    point_t point = p;
+    if (delta) point.move (*delta);
+    compiled->line_to (point);
+  }
+
+  void cubic_to (const point_t &p1, const point_t &p2, const point_t &p3)
+  {
+    point_t point1 = p1, point2 = p2, point3 = p3;
+    if (delta)
+    {
+      point1.move (*delta);
+      point2.move (*delta);
+      point3.move (*delta);
+    }
+    compiled->cubic_to (point1, point2, point3);
+  }
+
+  void end_path () { compiled->end_path (); }
+
+  cs_compiled_glyph_t *compiled;
+  point_t *delta;
+  bool seen_seac = false;
+
+  const OT::cff1::accelerator_t *cff;
+};
+
+struct cff1_path_procs_compile_t : path_procs_t<cff1_path_procs_compile_t, cff1_cs_interp_env_t, cff1_compile_param_t>
+{
+  static void moveto (cff1_cs_interp_env_t &env, cff1_compile_param_t& param, const point_t &pt)
+  {
+    param.move_to (pt);
+    env.moveto (pt);
+  }
+
+  static void line (cff1_cs_interp_env_t &env, cff1_compile_param_t &param, const point_t &pt1)
+  {
+    param.line_to (pt1);
+    env.moveto (pt1);
+  }
+
+  static void curve (cff1_cs_interp_env_t &env, cff1_compile_param_t &param, const point_t &pt1, const point_t &pt2, const point_t &pt3)
+  {
+    param.cubic_to (pt1, pt2, pt3);
+    env.moveto (pt3);
+  }
+};
+
+static bool _compile_path (const OT::cff1::accelerator_t *cff, hb_codepoint_t glyph,
+			   cs_compiled_glyph_t &compiled, bool in_seac = false,
+			   point_t *delta = nullptr, bool *seen_seac = nullptr);
+
+struct cff1_cs_opset_compile_t : cff1_cs_opset_t<cff1_cs_opset_compile_t, cff1_compile_param_t, cff1_path_procs_compile_t>
+{
+  static void process_seac (cff1_cs_interp_env_t &env, cff1_compile_param_t& param)
+  {
+    /* End previous path */
+    param.end_path ();
+    param.seen_seac = true;
+
+    unsigned int n = env.argStack.get_count ();
+    point_t delta;
+    delta.x = env.argStack[n-4];
+    delta.y = env.argStack[n-3];
+    hb_codepoint_t base = param.cff->std_code_to_glyph (env.argStack[n-2].to_int ());
+    hb_codepoint_t accent = param.cff->std_code_to_glyph (env.argStack[n-1].to_int ());
+
+    if (unlikely (!(!env.in_seac && base && accent
+		    && _compile_path (param.cff, base, *param.compiled, true)
+		    && _compile_path (param.cff, accent, *param.compiled, true, &delta))))
+      env.set_error ();
+  }
+};
+
+/* Records what _get_path() would draw, in font units. */
+bool _compile_path (const OT::cff1::accelerator_t *cff, hb_codepoint_t glyph,
+		    cs_compiled_glyph_t &compiled, bool in_seac,
+		    point_t *delta, bool *seen_seac)
+{
+  if (unlikely (!cff->is_valid () || (glyph >= cff->num_glyphs))) return false;
+
+  unsigned int fd = cff->fdSelect->get_fd (glyph);
+  const hb_ubytes_t str = (*cff->charStrings)[glyph];
+  cff1_cs_interp_env_t env (str, *cff, fd);
+  env.set_in_seac (in_seac);
+  cff1_cs_interpreter_t<cff1_cs_opset_compile_t, cff1_compile_param_t> interp (env);
+  cff1_compile_param_t param (cff, compiled, delta);
+  if (unlikely (!interp.interpret (param))) return false;
+
+  param.end_path ();
+
+  if (seen_seac) *seen_seac = param.seen_seac;
+  return true;
+}
+
+bool _compile (const OT::cff1::accelerator_t *cff, hb_codepoint_t glyph,
+	       cs_compiled_glyph_t &compiled)
+{
+  bool seen_seac;
+  if (!_compile_path (cff, glyph, compiled, false, nullptr, &seen_seac))
+    return false;
+
+  if (likely (!seen_seac))
+  {
+    compiled.update_bounds ();
+    return true;
+  }
+
+  /* The bounds of a seac glyph merge those of its components, which
+   * differs from the bounds of its points for degenerate components. */
+  bounds_t bounds;
+  if (!_get_bounds (cff, glyph, bounds))
+    return false;
+  compiled.min = bounds.min;
+  compiled.max = bounds.max;
+  return true;
+}
+
 struct get_seac_param_t
 {
   get_seac_param_t (const OT::cff1::accelerator_t *_cff) : cff (_cff) {}
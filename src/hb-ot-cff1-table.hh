@@ -28,6 +28,7 @@
 #define HB_OT_CFF1_TABLE_HH
 
 #include "hb-ot-cff-common.hh"
+#include "hb-cff-interp-cs-common.hh"
 #include "hb-subset-cff1.hh"
 #include "hb-draw.hh"
 #include "hb-paint.hh"
@@ -1324,6 +1325,7 @@ struct cff1
       SUPER::init (face);
 
       glyph_names.set_relaxed (nullptr);
+      charstring_cache.init ();
 
       if (!is_valid ()) return;
       if (is_CID ()) return;
@@ -1337,6 +1339,7 @@ struct cff1
 	names->fini ();
 	hb_free (names);
       }
+      charstring_cache.fini ();
 
       SUPER::fini ();
     }
@@ -1426,7 +1429,7 @@ struct cff1
       return true;
     }
 
-    HB_INTERNAL bool get_extents (hb_font_t *font, hb_codepoint_t glyph, hb_glyph_extents_t *extents) const;
+    HB_INTERNAL bool get_extents (hb_font_t *font, hb_codepoint_t glyph, hb_glyph_extents_t *extents, bool scaled = true) const;
     HB_INTERNAL bool paint_glyph (hb_font_t *font, hb_codepoint_t glyph, hb_paint_funcs_t *funcs, void *data, hb_color_t foreground) const;
     HB_INTERNAL bool get_seac_components (hb_codepoint_t glyph, hb_codepoint_t *base, hb_codepoint_t *accent) const;
     HB_INTERNAL bool get_path (hb_font_t *font, hb_codepoint_t glyph, hb_draw_session_t &draw_session) const;
@@ -1452,6 +1455,10 @@ struct cff1
 
     mutable hb_atomic_ptr_t<hb_sorted_vector_t<gname_t>> glyph_names;
 
+    public:
+    /* Compiled charstrings, for get_extents() and get_path(). */
+    mutable CFF::cs_charstring_cache_t charstring_cache;
+
     typedef accelerator_templ_t<cff1_private_dict_opset_t, cff1_private_dict_values_t> SUPER;
   };
 
@@ -99,9 +99,47 @@ struct cff2_path_procs_extents_t : path_procs_t<cff2_path_procs_extents_t, cff2_
 
 struct cff2_cs_opset_extents_t : cff2_cs_opset_t<cff2_cs_opset_extents_t, cff2_extents_param_t, number_t, cff2_path_procs_extents_t> {};
 
+struct cff2_path_procs_compile_t : path_procs_t<cff2_path_procs_compile_t, cff2_cs_interp_env_t<number_t>, cs_compiled_glyph_t>
+{
+  static void moveto (cff2_cs_interp_env_t<number_t> &env, cs_compiled_glyph_t& compiled, const point_t &pt)
+  {
+    compiled.move_to (pt);
+    env.moveto (pt);
+  }
+
+  static void line (cff2_cs_interp_env_t<number_t> &env, cs_compiled_glyph_t& compiled, const point_t &pt1)
+  {
+    compiled.line_to (pt1);
+    env.moveto (pt1);
+  }
+
+  static void curve (cff2_cs_interp_env_t<number_t> &env, cs_compiled_glyph_t& compiled, const point_t &pt1, const point_t &pt2, const point_t &pt3)
+  {
+    compiled.cubic_to (pt1, pt2, pt3);
+    env.moveto (pt3);
+  }
+};
+
+struct cff2_cs_opset_compile_t : cff2_cs_opset_t<cff2_cs_opset_compile_t, cs_compiled_glyph_t, number_t, cff2_path_procs_compile_t> {};
+
+/* Records what get_path() would draw, in font units, at font's coords. */
+static bool _compile (const OT::cff2::accelerator_t *cff, hb_font_t *font, hb_codepoint_t glyph,
+		      cs_compiled_glyph_t &compiled)
+{
+  unsigned int fd = cff->fdSelect->get_fd (glyph);
+  const hb_ubytes_t str = (*cff->charStrings)[glyph];
+  cff2_cs_interp_env_t<number_t> env (str, *cff, fd, font->coords, font->num_coords);
+  cff2_cs_interpreter_t<cff2_cs_opset_compile_t, cs_compiled_glyph_t, number_t> interp (env);
+  if (unlikely (!interp.interpret (compiled))) return false;
+
+  compiled.update_bounds ();
+  return true;
+}
+
 bool OT::cff2::accelerator_t::get_extents (hb_font_t *font,
 					   hb_codepoint_t glyph,
-					   hb_glyph_extents_t *extents) const
+					   hb_glyph_extents_t *extents,
+					   bool scaled) const
 {
 #ifdef HB_NO_OT_FONT_CFF
   /* XXX Remove check when this code moves to .hh file. */
@@ -110,12 +148,23 @@ bool OT::cff2::accelerator_t::get_extents (hb_font_t *font,
 
   if (unlikely (!is_valid () || (glyph >= num_glyphs))) return false;
 
-  unsigned int fd = fdSelect->get_fd (glyph);
-  const hb_ubytes_t str = (*charStrings)[glyph];
-  cff2_cs_interp_env_t<number_t> env (str, *this, fd, font->coords, font->num_coords);
-  cff2_cs_interpreter_t<cff2_cs_opset_extents_t, cff2_extents_param_t, number_t> interp (env);
   cff2_extents_param_t  param;
-  if (unlikely (!interp.interpret (param))) return false;
+  if (!charstring_cache.with_glyph (glyph, font->coords, font->num_coords,
+				    [&] (cs_compiled_glyph_t &compiled) { return _compile (this, font, glyph, compiled); },
+				    [&] (const cs_compiled_glyph_t &compiled)
+				    {
+				      param.min_x = compiled.min.x;
+				      param.min_y = compiled.min.y;
+				      param.max_x = compiled.max.x;
+				      param.max_y = compiled.max.y;
+				    }))
+  {
+    unsigned int fd = fdSelect->get_fd (glyph);
+    const hb_ubytes_t str = (*charStrings)[glyph];
+    cff2_cs_interp_env_t<number_t> env (str, *this, fd, font->coords, font->num_coords);
+    cff2_cs_interpreter_t<cff2_cs_opset_extents_t, cff2_extents_param_t, number_t> interp (env);
+    if (unlikely (!interp.interpret (param))) return false;
+  }
 
   if (param.min_x >= param.max_x)
   {
@@ -138,7 +187,8 @@ bool OT::cff2::accelerator_t::get_extents (hb_font_t *font,
     extents->height = roundf (param.min_y.to_real () - extents->y_bearing);
   }
 
-  font->scale_glyph_extents (extents);
+  if (scaled)
+    font->scale_glyph_extents (extents);
 
   return true;
 }
@@ -173,6 +223,8 @@ struct cff2_path_param_t
 			   font->em_fscalef_x (p3.x.to_real ()), font->em_fscalef_y (p3.y.to_real ()));
   }
 
+  void end_path () { draw_session->close_path (); }
+
   protected:
   hb_draw_session_t *draw_session;
   hb_font_t *font;
@@ -210,6 +262,15 @@ bool OT::cff2::accelerator_t::get_path (hb_font_t *font, hb_codepoint_t glyph, h
 
   if (unlikely (!is_valid () || (glyph >= num_glyphs))) return false;
 
+  if (charstring_cache.with_glyph (glyph, font->coords, font->num_coords,
+				   [&] (cs_compiled_glyph_t &compiled) { return _compile (this, font, glyph, compiled); },
+				   [&] (const cs_compiled_glyph_t &compiled)
+				   {
+				     cff2_path_param_t param (font, draw_session);
+				     compiled.replay (param);
+				   }))
+    return true;
+
   unsigned int fd = fdSelect->get_fd (glyph);
   const hb_ubytes_t str = (*charStrings)[glyph];
   cff2_cs_interp_env_t<number_t> env (str, *this, fd, font->coords, font->num_coords);
@@ -28,6 +28,7 @@
 #define HB_OT_CFF2_TABLE_HH
 
 #include "hb-ot-cff-common.hh"
+#include "hb-cff-interp-cs-common.hh"
 #include "hb-subset-cff2.hh"
 #include "hb-draw.hh"
 #include "hb-paint.hh"
@@ -512,13 +513,18 @@ struct cff2
 
   struct accelerator_t : accelerator_templ_t<cff2_private_dict_opset_t, cff2_private_dict_values_t>
   {
-    accelerator_t (hb_face_t *face) : accelerator_templ_t (face) {}
+    accelerator_t (hb_face_t *face) : accelerator_templ_t (face) { charstring_cache.init (); }
+    ~accelerator_t () { charstring_cache.fini (); }
 
     HB_INTERNAL bool get_extents (hb_font_t *font,
 				  hb_codepoint_t glyph,
-				  hb_glyph_extents_t *extents) const;
+				  hb_glyph_extents_t *extents,
+				  bool scaled = true) const;
     HB_INTERNAL bool paint_glyph (hb_font_t *font, hb_codepoint_t glyph, hb_paint_funcs_t *funcs, void *data, hb_color_t foreground) const;
     HB_INTERNAL bool get_path (hb_font_t *font, hb_codepoint_t glyph, hb_draw_session_t &draw_session) const;
+
+    /* Compiled charstrings, for get_extents() and get_path(). */
+    mutable CFF::cs_charstring_cache_t charstring_cache;
   };
 
   typedef accelerator_templ_t<cff2_private_dict_opset_subset_t, cff2_private_dict_values_subset_t> accelerator_subset_t;
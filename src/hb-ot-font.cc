@@ -62,6 +62,927 @@
 
 using hb_ot_font_advance_cache_t = hb_cache_t<24, 16, 8, true>;
 
+/* Unscaled glyph outline extents, kept in one lockfree cache per field;
+ * a glyph is found only if all four caches have it.  Fields are stored
+ * biased by 0x8000; extents that do not fit 16 bits are not cached. */
+struct hb_ot_font_extents_cache_t
+{
+  void init ()
+  {
+    for (unsigned i = 0; i < ARRAY_LENGTH (fields); i++)
+      fields[i].init ();
+  }
+
+  bool get (hb_codepoint_t glyph, hb_glyph_extents_t *extents) const
+  {
+    /* The stored items do not fill 32 bits, so hb_cache_t cannot tell an
+     * empty slot from the high bits of large glyph ids; keep those out. */
+    if (unlikely (glyph > 0xFFFFu))
+      return false;
+    unsigned v[4];
+    for (unsigned i = 0; i < ARRAY_LENGTH (fields); i++)
+      if (!fields[i].get (glyph, &v[i]))
+	return false;
+    extents->x_bearing = (int) v[0] - 0x8000;
+    extents->y_bearing = (int) v[1] - 0x8000;
+    extents->width     = (int) v[2] - 0x8000;
+    extents->height    = (int) v[3] - 0x8000;
+    return true;
+  }
+
+  void set (hb_codepoint_t glyph, const hb_glyph_extents_t &extents)
+  {
+    int v[4] = {extents.x_bearing, extents.y_bearing, extents.width, extents.height};
+    for (unsigned i = 0; i < ARRAY_LENGTH (v); i++)
+      if (v[i] < -0x8000 || v[i] > 0x7FFF)
+	return;
+    for (unsigned i = 0; i < ARRAY_LENGTH (fields); i++)
+      fields[i].set (glyph, v[i] + 0x8000);
+  }
+
+  hb_cache_t<16, 16, 10, true> fields[4];
+};
+
+#ifndef HB_NO_DRAW
+/* A glyph outline, recorded in font units.  Outlines are
+ * reference-counted, so that they can be replayed outside of the cache
+ * lock while another thread evicts them. */
+struct hb_ot_font_outline_t
+{
+  enum verb_t : uint8_t
+  {
+    MOVE_TO,
+    LINE_TO,
+    QUADRATIC_TO,
+    CUBIC_TO,
+    CLOSE_PATH
+  };
+
+  static hb_ot_font_outline_t *
+  create (hb_codepoint_t glyph)
+  {
+    hb_ot_font_outline_t *outline = (hb_ot_font_outline_t *) hb_calloc (1, sizeof (hb_ot_font_outline_t));
+    if (unlikely (!outline))
+      return nullptr;
+    outline->ref_count.set_relaxed (1);
+    outline->glyph = glyph;
+    outline->verbs.init ();
+    outline->points.init ();
+    return outline;
+  }
+
+  hb_ot_font_outline_t *reference ()
+  {
+    ref_count.inc ();
+    return this;
+  }
+
+  void destroy ()
+  {
+    if (ref_count.dec () != 1)
+      return;
+    points.fini ();
+    verbs.fini ();
+    hb_free (this);
+  }
+
+  bool in_error () const { return verbs.in_error () || points.in_error (); }
+
+  void add (verb_t verb, std::initializer_list<float> coords)
+  {
+    verbs.push (verb);
+    for (float v : coords)
+      points.push (v);
+  }
+
+  void replay (hb_font_t *font, hb_draw_session_t &draw_session) const
+  {
+    const float *p = points.arrayZ;
+    for (uint8_t verb : verbs)
+      switch (verb)
+      {
+      case MOVE_TO:
+	draw_session.move_to (font->em_fscalef_x (p[0]), font->em_fscalef_y (p[1]));
+	p += 2;
+	break;
+      case LINE_TO:
+	draw_session.line_to (font->em_fscalef_x (p[0]), font->em_fscalef_y (p[1]));
+	p += 2;
+	break;
+      case QUADRATIC_TO:
+	draw_session.quadratic_to (font->em_fscalef_x (p[0]), font->em_fscalef_y (p[1]),
+				   font->em_fscalef_x (p[2]), font->em_fscalef_y (p[3]));
+	p += 4;
+	break;
+      case CUBIC_TO:
+	draw_session.cubic_to (font->em_fscalef_x (p[0]), font->em_fscalef_y (p[1]),
+			       font->em_fscalef_x (p[2]), font->em_fscalef_y (p[3]),
+			       font->em_fscalef_x (p[4]), font->em_fscalef_y (p[5]));
+	p += 6;
+	break;
+      case CLOSE_PATH:
+	draw_session.close_path ();
+	break;
+      }
+  }
+
+  hb_atomic_int_t ref_count;
+  hb_codepoint_t glyph;
+  hb_vector_t<uint8_t> verbs;
+  hb_vector_t<float> points; /* x,y pairs. */
+};
+
+static void
+hb_ot_outline_record_move_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+			      void *data,
+			      hb_draw_state_t *st HB_UNUSED,
+			      float to_x, float to_y,
+			      void *user_data HB_UNUSED)
+{
+  ((hb_ot_font_outline_t *) data)->add (hb_ot_font_outline_t::MOVE_TO, {to_x, to_y});
+}
+
+static void
+hb_ot_outline_record_line_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+			      void *data,
+			      hb_draw_state_t *st HB_UNUSED,
+			      float to_x, float to_y,
+			      void *user_data HB_UNUSED)
+{
+  ((hb_ot_font_outline_t *) data)->add (hb_ot_font_outline_t::LINE_TO, {to_x, to_y});
+}
+
+static void
+hb_ot_outline_record_quadratic_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+				   void *data,
+				   hb_draw_state_t *st HB_UNUSED,
+				   float control_x, float control_y,
+				   float to_x, float to_y,
+				   void *user_data HB_UNUSED)
+{
+  ((hb_ot_font_outline_t *) data)->add (hb_ot_font_outline_t::QUADRATIC_TO,
+					{control_x, control_y, to_x, to_y});
+}
+
+static void
+hb_ot_outline_record_cubic_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+			       void *data,
+			       hb_draw_state_t *st HB_UNUSED,
+			       float control1_x, float control1_y,
+			       float control2_x, float control2_y,
+			       float to_x, float to_y,
+			       void *user_data HB_UNUSED)
+{
+  ((hb_ot_font_outline_t *) data)->add (hb_ot_font_outline_t::CUBIC_TO,
+					{control1_x, control1_y,
+					 control2_x, control2_y,
+					 to_x, to_y});
+}
+
+static void
+hb_ot_outline_record_close_path (hb_draw_funcs_t *dfuncs HB_UNUSED,
+				 void *data,
+				 hb_draw_state_t *st HB_UNUSED,
+				 void *user_data HB_UNUSED)
+{
+  ((hb_ot_font_outline_t *) data)->add (hb_ot_font_outline_t::CLOSE_PATH, {});
+}
+
+static inline void free_static_ot_outline_record_funcs ();
+
+static struct hb_ot_outline_record_funcs_lazy_loader_t : hb_draw_funcs_lazy_loader_t<hb_ot_outline_record_funcs_lazy_loader_t>
+{
+  static hb_draw_funcs_t *create ()
+  {
+    hb_draw_funcs_t *funcs = hb_draw_funcs_create ();
+
+    hb_draw_funcs_set_move_to_func (funcs, hb_ot_outline_record_move_to, nullptr, nullptr);
+    hb_draw_funcs_set_line_to_func (funcs, hb_ot_outline_record_line_to, nullptr, nullptr);
+    hb_draw_funcs_set_quadratic_to_func (funcs, hb_ot_outline_record_quadratic_to, nullptr, nullptr);
+    hb_draw_funcs_set_cubic_to_func (funcs, hb_ot_outline_record_cubic_to, nullptr, nullptr);
+    hb_draw_funcs_set_close_path_func (funcs, hb_ot_outline_record_close_path, nullptr, nullptr);
+
+    hb_draw_funcs_make_immutable (funcs);
+
+    hb_atexit (free_static_ot_outline_record_funcs);
+
+    return funcs;
+  }
+} static_ot_outline_record_funcs;
+
+static inline
+void free_static_ot_outline_record_funcs ()
+{
+  static_ot_outline_record_funcs.free_instance ();
+}
+
+/* Opt-in cache of glyph outlines for hb_font_draw_glyph().  Outlines are
+ * recorded in font units on a private font at the variation coordinates of
+ * the font being drawn, so they survive scale and slant changes and are
+ * only dropped when the coordinates change.  Evicts in FIFO order. */
+struct hb_ot_font_outline_cache_t
+{
+  bool init (hb_face_t *face, unsigned capacity_)
+  {
+    lock.init ();
+    capacity = capacity_;
+    next = 0;
+    hits = misses = 0;
+    coords_valid = false;
+    serial_coords = 0;
+    glyphs.init ();
+    outlines.init ();
+    record_font = hb_font_create (face);
+    return record_font != hb_font_get_empty ();
+  }
+
+  void fini ()
+  {
+    clear ();
+    hb_font_destroy (record_font);
+    outlines.fini ();
+    glyphs.fini ();
+    lock.fini ();
+  }
+
+  void clear ()
+  {
+    for (hb_ot_font_outline_t *outline : outlines)
+      outline->destroy ();
+    outlines.resize (0);
+    glyphs.clear ();
+    next = 0;
+  }
+
+  /* Returns a reference to the outline of @glyph, recording it first if
+   * needed, or nullptr on failure.  Recording only calls into our own
+   * draw funcs, so it is safe under the lock; the caller replays the
+   * outline after the lock is dropped. */
+  hb_ot_font_outline_t *
+  get_outline (hb_font_t *font, hb_codepoint_t glyph)
+  {
+    hb_lock_t l (lock);
+
+    if (!coords_valid || serial_coords != font->serial_coords)
+    {
+      clear ();
+#ifndef HB_NO_VAR
+      hb_font_set_var_coords_normalized (record_font, font->coords, font->num_coords);
+#endif
+      serial_coords = font->serial_coords;
+      coords_valid = true;
+    }
+
+    unsigned *index;
+    if (glyphs.has (glyph, &index))
+    {
+      hits++;
+      return outlines.arrayZ[*index]->reference ();
+    }
+    misses++;
+
+    hb_ot_font_outline_t *outline = hb_ot_font_outline_t::create (glyph);
+    if (unlikely (!outline))
+      return nullptr;
+    {
+      hb_draw_session_t record_session (static_ot_outline_record_funcs.get_unconst (), outline);
+      hb_face_t *face = record_font->face;
+      if (!face->table.glyf->get_path (record_font, glyph, record_session))
+      {
+#ifndef HB_NO_CFF
+	if (!face->table.cff1->get_path (record_font, glyph, record_session))
+	  face->table.cff2->get_path (record_font, glyph, record_session);
+#endif
+      }
+    }
+    if (unlikely (outline->in_error ()))
+    {
+      outline->destroy ();
+      return nullptr;
+    }
+
+    unsigned i;
+    if (outlines.length < capacity)
+    {
+      i = outlines.length;
+      outlines.push (nullptr);
+      if (unlikely (outlines.in_error ()))
+	return outline;
+    }
+    else
+    {
+      i = next;
+      next = (next + 1) % capacity;
+      glyphs.del (outlines.arrayZ[i]->glyph);
+      outlines.arrayZ[i]->destroy ();
+    }
+    outlines.arrayZ[i] = outline->reference ();
+    glyphs.set (glyph, i);
+
+    return outline;
+  }
+
+  void get_stats (unsigned *hits_, unsigned *misses_)
+  {
+    hb_lock_t l (lock);
+    if (hits_) *hits_ = hits;
+    if (misses_) *misses_ = misses;
+  }
+
+  hb_mutex_t lock;
+  unsigned capacity;
+  unsigned next;
+  unsigned hits;
+  unsigned misses;
+  bool coords_valid;
+  unsigned serial_coords;
+  hb_font_t *record_font;
+  hb_hashmap_t<hb_codepoint_t, unsigned> glyphs;
+  hb_vector_t<hb_ot_font_outline_t *> outlines;
+};
+
+static void
+_hb_ot_font_outline_cache_destroy (hb_ot_font_outline_cache_t *cache)
+{
+  if (!cache) return;
+  cache->fini ();
+  hb_free (cache);
+}
+#endif
+
+#if !defined(HB_NO_PAINT) && !defined(HB_NO_COLOR)
+/* The paint calls of one COLR glyph, recorded for replay.  Colors and
+ * color lines are recorded resolved, so a program is only valid for the
+ * palette, foreground and font state it was recorded with.  Programs are
+ * reference-counted, so that they can be replayed outside of the cache
+ * lock while another thread evicts them. */
+struct hb_ot_font_paint_program_t
+{
+  enum op_t : uint8_t
+  {
+    PUSH_TRANSFORM,
+    POP_TRANSFORM,
+    PUSH_CLIP_GLYPH,
+    PUSH_CLIP_RECTANGLE,
+    POP_CLIP,
+    COLOR,
+    LINEAR_GRADIENT,
+    RADIAL_GRADIENT,
+    SWEEP_GRADIENT,
+    PUSH_GROUP,
+    POP_GROUP
+  };
+
+  static hb_ot_font_paint_program_t *
+  create (hb_codepoint_t glyph, unsigned palette, hb_color_t foreground)
+  {
+    hb_ot_font_paint_program_t *program = (hb_ot_font_paint_program_t *) hb_calloc (1, sizeof (hb_ot_font_paint_program_t));
+    if (unlikely (!program))
+      return nullptr;
+    program->ref_count.set_relaxed (1);
+    program->glyph = glyph;
+    program->palette = palette;
+    program->foreground = foreground;
+    program->replayable = true;
+    program->ops.init ();
+    program->floats.init ();
+    program->ints.init ();
+    program->stops.init ();
+    return program;
+  }
+
+  hb_ot_font_paint_program_t *reference ()
+  {
+    ref_count.inc ();
+    return this;
+  }
+
+  void destroy ()
+  {
+    if (ref_count.dec () != 1)
+      return;
+    stops.fini ();
+    ints.fini ();
+    floats.fini ();
+    ops.fini ();
+    hb_free (this);
+  }
+
+  bool in_error () const
+  {
+    return ops.in_error () || floats.in_error () ||
+	   ints.in_error () || stops.in_error ();
+  }
+
+  void add (op_t op,
+	    std::initializer_list<float> fs = {},
+	    std::initializer_list<unsigned> is = {})
+  {
+    ops.push (op);
+    for (float v : fs)
+      floats.push (v);
+    for (unsigned v : is)
+      ints.push (v);
+  }
+
+  void add_color_line (hb_color_line_t *color_line)
+  {
+    unsigned count = hb_color_line_get_color_stops (color_line, 0, nullptr, nullptr);
+    unsigned start = stops.length;
+    if (unlikely (!stops.resize (start + count)))
+      return;
+    hb_color_line_get_color_stops (color_line, 0, &count, stops.arrayZ + start);
+    stops.resize (start + count);
+    ints.push (hb_color_line_get_extend (color_line));
+    ints.push (count);
+  }
+
+  struct color_line_data_t
+  {
+    const hb_color_stop_t *stops;
+    unsigned count;
+    hb_paint_extend_t extend;
+  };
+
+  static unsigned
+  get_color_stops (hb_color_line_t *color_line HB_UNUSED,
+		   void *color_line_data,
+		   unsigned int start,
+		   unsigned int *count,
+		   hb_color_stop_t *color_stops,
+		   void *user_data HB_UNUSED)
+  {
+    const color_line_data_t *data = (const color_line_data_t *) color_line_data;
+    if (count && color_stops)
+    {
+      unsigned n = start < data->count ? hb_min (*count, data->count - start) : 0;
+      hb_memcpy (color_stops, data->stops + start, n * sizeof (color_stops[0]));
+      *count = n;
+    }
+    return data->count;
+  }
+
+  static hb_paint_extend_t
+  get_extend (hb_color_line_t *color_line HB_UNUSED,
+	      void *color_line_data,
+	      void *user_data HB_UNUSED)
+  {
+    return ((const color_line_data_t *) color_line_data)->extend;
+  }
+
+  void replay (hb_font_t *font, hb_paint_funcs_t *funcs, void *paint_data) const
+  {
+    const float *f = floats.arrayZ;
+    const unsigned *i = ints.arrayZ;
+    const hb_color_stop_t *s = stops.arrayZ;
+    color_line_data_t data;
+    hb_color_line_t cl = {
+      &data,
+      get_color_stops, nullptr,
+      get_extend, nullptr
+    };
+    for (uint8_t op : ops)
+    {
+      if (op >= LINEAR_GRADIENT && op <= SWEEP_GRADIENT)
+      {
+	data.extend = (hb_paint_extend_t) i[0];
+	data.count = i[1];
+	data.stops = s;
+	s += data.count;
+	i += 2;
+      }
+      switch (op)
+      {
+      case PUSH_TRANSFORM:
+	funcs->push_transform (paint_data, f[0], f[1], f[2], f[3], f[4], f[5]);
+	f += 6;
+	break;
+      case POP_TRANSFORM:
+	funcs->pop_transform (paint_data);
+	break;
+      case PUSH_CLIP_GLYPH:
+	funcs->push_clip_glyph (paint_data, i[0], font);
+	i += 1;
+	break;
+      case PUSH_CLIP_RECTANGLE:
+	funcs->push_clip_rectangle (paint_data, f[0], f[1], f[2], f[3]);
+	f += 4;
+	break;
+      case POP_CLIP:
+	funcs->pop_clip (paint_data);
+	break;
+      case COLOR:
+	funcs->color (paint_data, i[0], i[1]);
+	i += 2;
+	break;
+      case LINEAR_GRADIENT:
+	funcs->linear_gradient (paint_data, &cl, f[0], f[1], f[2], f[3], f[4], f[5]);
+	f += 6;
+	break;
+      case RADIAL_GRADIENT:
+	funcs->radial_gradient (paint_data, &cl, f[0], f[1], f[2], f[3], f[4], f[5]);
+	f += 6;
+	break;
+      case SWEEP_GRADIENT:
+	funcs->sweep_gradient (paint_data, &cl, f[0], f[1], f[2], f[3]);
+	f += 4;
+	break;
+      case PUSH_GROUP:
+	funcs->push_group (paint_data);
+	break;
+      case POP_GROUP:
+	funcs->pop_group (paint_data, (hb_paint_composite_mode_t) i[0]);
+	i += 1;
+	break;
+      }
+    }
+  }
+
+  hb_atomic_int_t ref_count;
+  hb_codepoint_t glyph;
+  unsigned palette;
+  hb_color_t foreground;
+  bool painted;    /* Whether COLR has a paint for the glyph at all. */
+  bool replayable; /* False if the glyph used calls we do not record. */
+  hb_vector_t<uint8_t> ops;
+  hb_vector_t<float> floats;
+  hb_vector_t<unsigned> ints;
+  hb_vector_t<hb_color_stop_t> stops;
+};
+
+#define HB_OT_PAINT_PROGRAM(data) ((hb_ot_font_paint_program_t *) (data))
+
+static void
+hb_ot_paint_record_push_transform (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+				   float xx, float yx,
+				   float xy, float yy,
+				   float dx, float dy,
+				   void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::PUSH_TRANSFORM,
+				   {xx, yx, xy, yy, dx, dy});
+}
+
+static void
+hb_ot_paint_record_pop_transform (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+				  void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::POP_TRANSFORM);
+}
+
+static void
+hb_ot_paint_record_push_clip_glyph (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+				    hb_codepoint_t glyph,
+				    hb_font_t *font HB_UNUSED,
+				    void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::PUSH_CLIP_GLYPH,
+				   {}, {glyph});
+}
+
+static void
+hb_ot_paint_record_push_clip_rectangle (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+					float xmin, float ymin, float xmax, float ymax,
+					void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::PUSH_CLIP_RECTANGLE,
+				   {xmin, ymin, xmax, ymax});
+}
+
+static void
+hb_ot_paint_record_pop_clip (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+			     void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::POP_CLIP);
+}
+
+static void
+hb_ot_paint_record_color (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+			  hb_bool_t is_foreground,
+			  hb_color_t color,
+			  void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::COLOR,
+				   {}, {(unsigned) is_foreground, color});
+}
+
+static hb_bool_t
+hb_ot_paint_record_image (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+			  hb_blob_t *blob HB_UNUSED,
+			  unsigned width HB_UNUSED,
+			  unsigned height HB_UNUSED,
+			  hb_tag_t format HB_UNUSED,
+			  float slant HB_UNUSED,
+			  hb_glyph_extents_t *extents HB_UNUSED,
+			  void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->replayable = false;
+  return false;
+}
+
+static void
+hb_ot_paint_record_linear_gradient (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+				    hb_color_line_t *color_line,
+				    float x0, float y0,
+				    float x1, float y1,
+				    float x2, float y2,
+				    void *user_data HB_UNUSED)
+{
+  hb_ot_font_paint_program_t *program = HB_OT_PAINT_PROGRAM (data);
+  program->add (hb_ot_font_paint_program_t::LINEAR_GRADIENT, {x0, y0, x1, y1, x2, y2});
+  program->add_color_line (color_line);
+}
+
+static void
+hb_ot_paint_record_radial_gradient (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+				    hb_color_line_t *color_line,
+				    float x0, float y0, float r0,
+				    float x1, float y1, float r1,
+				    void *user_data HB_UNUSED)
+{
+  hb_ot_font_paint_program_t *program = HB_OT_PAINT_PROGRAM (data);
+  program->add (hb_ot_font_paint_program_t::RADIAL_GRADIENT, {x0, y0, r0, x1, y1, r1});
+  program->add_color_line (color_line);
+}
+
+static void
+hb_ot_paint_record_sweep_gradient (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+				   hb_color_line_t *color_line,
+				   float x0, float y0,
+				   float start_angle, float end_angle,
+				   void *user_data HB_UNUSED)
+{
+  hb_ot_font_paint_program_t *program = HB_OT_PAINT_PROGRAM (data);
+  program->add (hb_ot_font_paint_program_t::SWEEP_GRADIENT, {x0, y0, start_angle, end_angle});
+  program->add_color_line (color_line);
+}
+
+static void
+hb_ot_paint_record_push_group (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+			       void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::PUSH_GROUP);
+}
+
+static void
+hb_ot_paint_record_pop_group (hb_paint_funcs_t *funcs HB_UNUSED, void *data,
+			      hb_paint_composite_mode_t mode,
+			      void *user_data HB_UNUSED)
+{
+  HB_OT_PAINT_PROGRAM (data)->add (hb_ot_font_paint_program_t::POP_GROUP,
+				   {}, {(unsigned) mode});
+}
+
+#undef HB_OT_PAINT_PROGRAM
+
+static inline void free_static_ot_paint_record_funcs ();
+
+static struct hb_ot_paint_record_funcs_lazy_loader_t : hb_paint_funcs_lazy_loader_t<hb_ot_paint_record_funcs_lazy_loader_t>
+{
+  static hb_paint_funcs_t *create ()
+  {
+    hb_paint_funcs_t *funcs = hb_paint_funcs_create ();
+
+    hb_paint_funcs_set_push_transform_func (funcs, hb_ot_paint_record_push_transform, nullptr, nullptr);
+    hb_paint_funcs_set_pop_transform_func (funcs, hb_ot_paint_record_pop_transform, nullptr, nullptr);
+    hb_paint_funcs_set_push_clip_glyph_func (funcs, hb_ot_paint_record_push_clip_glyph, nullptr, nullptr);
+    hb_paint_funcs_set_push_clip_rectangle_func (funcs, hb_ot_paint_record_push_clip_rectangle, nullptr, nullptr);
+    hb_paint_funcs_set_pop_clip_func (funcs, hb_ot_paint_record_pop_clip, nullptr, nullptr);
+    hb_paint_funcs_set_push_group_func (funcs, hb_ot_paint_record_push_group, nullptr, nullptr);
+    hb_paint_funcs_set_pop_group_func (funcs, hb_ot_paint_record_pop_group, nullptr, nullptr);
+    hb_paint_funcs_set_color_func (funcs, hb_ot_paint_record_color, nullptr, nullptr);
+    hb_paint_funcs_set_image_func (funcs, hb_ot_paint_record_image, nullptr, nullptr);
+    hb_paint_funcs_set_linear_gradient_func (funcs, hb_ot_paint_record_linear_gradient, nullptr, nullptr);
+    hb_paint_funcs_set_radial_gradient_func (funcs, hb_ot_paint_record_radial_gradient, nullptr, nullptr);
+    hb_paint_funcs_set_sweep_gradient_func (funcs, hb_ot_paint_record_sweep_gradient, nullptr, nullptr);
+
+    hb_paint_funcs_make_immutable (funcs);
+
+    hb_atexit (free_static_ot_paint_record_funcs);
+
+    return funcs;
+  }
+} static_ot_paint_record_funcs;
+
+static inline
+void free_static_ot_paint_record_funcs ()
+{
+  static_ot_paint_record_funcs.free_instance ();
+}
+
+/* Opt-in cache of COLR paint programs for hb_font_paint_glyph().  The
+ * recorded calls are in font scale, with clip boxes and computed clip
+ * extents already applied, so the cache is dropped whenever the font
+ * changes in any way.  Each glyph keeps one program, for the palette and
+ * foreground it was last painted with.  Evicts in FIFO order. */
+struct hb_ot_font_paint_cache_t
+{
+  void init (unsigned capacity_)
+  {
+    lock.init ();
+    capacity = capacity_;
+    next = 0;
+    hits = misses = 0;
+    serial_valid = false;
+    serial = 0;
+    glyphs.init ();
+    programs.init ();
+  }
+
+  void fini ()
+  {
+    clear ();
+    programs.fini ();
+    glyphs.fini ();
+    lock.fini ();
+  }
+
+  void clear ()
+  {
+    for (hb_ot_font_paint_program_t *program : programs)
+      program->destroy ();
+    programs.resize (0);
+    glyphs.clear ();
+    next = 0;
+  }
+
+  /* Returns a reference to the program of @glyph, recording it first if
+   * needed, or nullptr if the glyph cannot be replayed from a program. */
+  hb_ot_font_paint_program_t *
+  get_program (hb_font_t *font,
+	       hb_codepoint_t glyph,
+	       unsigned int palette,
+	       hb_color_t foreground)
+  {
+    {
+      hb_lock_t l (lock);
+
+      if (!serial_valid || serial != font->serial)
+      {
+	clear ();
+	serial = font->serial;
+	serial_valid = true;
+      }
+
+      unsigned *index;
+      if (glyphs.has (glyph, &index))
+      {
+	hb_ot_font_paint_program_t *program = programs.arrayZ[*index];
+	if (program->palette == palette && program->foreground == foreground)
+	{
+	  hits++;
+	  return program->reference ();
+	}
+      }
+      misses++;
+    }
+
+    /* Record outside of the lock; COLR does not call back into the font. */
+    hb_ot_font_paint_program_t *program = hb_ot_font_paint_program_t::create (glyph, palette, foreground);
+    if (unlikely (!program))
+      return nullptr;
+    program->painted = font->face->table.COLR->paint_glyph (font, glyph,
+							    static_ot_paint_record_funcs.get_unconst (), program,
+							    palette, foreground);
+    if (unlikely (!program->replayable || program->in_error ()))
+    {
+      program->destroy ();
+      return nullptr;
+    }
+
+    hb_lock_t l (lock);
+    if (serial != font->serial)
+      return program;
+
+    unsigned i;
+    unsigned *index;
+    if (glyphs.has (glyph, &index))
+    {
+      i = *index;
+      programs.arrayZ[i]->destroy ();
+    }
+    else if (programs.length < capacity)
+    {
+      i = programs.length;
+      programs.push (nullptr);
+      if (unlikely (programs.in_error ()))
+	return program;
+    }
+    else
+    {
+      i = next;
+      next = (next + 1) % capacity;
+      glyphs.del (programs.arrayZ[i]->glyph);
+      programs.arrayZ[i]->destroy ();
+    }
+    programs.arrayZ[i] = program->reference ();
+    glyphs.set (glyph, i);
+
+    return program;
+  }
+
+  void get_stats (unsigned *hits_, unsigned *misses_)
+  {
+    hb_lock_t l (lock);
+    if (hits_) *hits_ = hits;
+    if (misses_) *misses_ = misses;
+  }
+
+  hb_mutex_t lock;
+  unsigned capacity;
+  unsigned next;
+  unsigned hits;
+  unsigned misses;
+  bool serial_valid;
+  unsigned serial;
+  hb_hashmap_t<hb_codepoint_t, unsigned> glyphs;
+  hb_vector_t<hb_ot_font_paint_program_t *> programs;
+};
+
+static void
+_hb_ot_font_paint_cache_destroy (hb_ot_font_paint_cache_t *cache)
+{
+  if (!cache) return;
+  cache->fini ();
+  hb_free (cache);
+}
+#endif
+
+#ifndef HB_NO_VAR
+/* The scalars of one variation source at the font's current coords:
+ * the region scalars of an item variation store, or the gvar shared
+ * tuple scalars.  Computed in full once per coords change into a fresh
+ * instance, which is then published and read by all lookups on the font
+ * until the coords change again.  A published instance is never written
+ * to.  The instance it replaces is kept until the next replacement: that
+ * one can only happen after another coords change, and setting coords
+ * requires that no other thread is using the font, so by then nobody
+ * can still be looking at it. */
+template <typename Source>
+struct hb_ot_font_scalars_t
+{
+  using cache_t = typename Source::cache_t;
+
+  struct instance_t
+  {
+    unsigned serial_coords;
+    cache_t *cache;
+  };
+
+  static void destroy_instance (instance_t *instance)
+  {
+    if (!instance) return;
+    Source::destroy_cache (instance->cache);
+    hb_free (instance);
+  }
+
+  void fini ()
+  {
+    destroy_instance (current.get_relaxed ());
+    destroy_instance (retired.get_relaxed ());
+  }
+
+  /* Returns nullptr if font has no coords or on allocation failure;
+   * callers then evaluate the scalars as they go. */
+  cache_t *get (const Source &source, hb_font_t *font) const
+  {
+    if (!font->num_coords)
+      return nullptr;
+
+    instance_t *old = current.get_acquire ();
+    if (likely (old && old->serial_coords == font->serial_coords))
+      return old->cache;
+
+    cache_t *cache = source.create_cache ();
+    if (unlikely (!cache))
+      return nullptr;
+    instance_t *instance = (instance_t *) hb_malloc (sizeof (instance_t));
+    if (unlikely (!instance))
+    {
+      Source::destroy_cache (cache);
+      return nullptr;
+    }
+    source.fill_cache (cache, hb_array (font->coords, font->num_coords));
+    instance->serial_coords = font->serial_coords;
+    instance->cache = cache;
+
+    if (unlikely (!current.cmpexch (old, instance)))
+    {
+      /* Another thread published first; it can only have been for the
+       * current coords. */
+      destroy_instance (instance);
+      return current.get_acquire ()->cache;
+    }
+    destroy_instance (retired.get_relaxed ());
+    retired.set_relaxed (old);
+    return instance->cache;
+  }
+
+  mutable hb_atomic_ptr_t<instance_t> current;
+  mutable hb_atomic_ptr_t<instance_t> retired;
+};
+#endif
+
 struct hb_ot_font_t
 {
   const hb_ot_face_t *ot_face;
@@ -69,6 +990,28 @@ struct hb_ot_font_t
   /* h_advance caching */
   mutable hb_atomic_int_t cached_coords_serial;
   mutable hb_atomic_ptr_t<hb_ot_font_advance_cache_t> advance_cache;
+
+  /* glyph extents caching */
+  mutable hb_atomic_int_t extents_cached_coords_serial;
+  mutable hb_atomic_ptr_t<hb_ot_font_extents_cache_t> extents_cache;
+
+#ifndef HB_NO_VAR
+  /* Variation scalars caching */
+  hb_ot_font_scalars_t<OT::gvar_accelerator_t> gvar_scalars;
+  hb_ot_font_scalars_t<OT::VariationStore> hvar_scalars;
+  hb_ot_font_scalars_t<OT::VariationStore> vvar_scalars;
+  hb_ot_font_scalars_t<OT::VariationStore> mvar_scalars;
+#endif
+
+#ifndef HB_NO_DRAW
+  /* Outline caching; see hb_ot_font_set_outline_cache_capacity(). */
+  mutable hb_atomic_ptr_t<hb_ot_font_outline_cache_t> outline_cache;
+#endif
+
+#if !defined(HB_NO_PAINT) && !defined(HB_NO_COLOR)
+  /* COLR paint caching; see hb_ot_font_set_paint_cache_capacity(). */
+  mutable hb_atomic_ptr_t<hb_ot_font_paint_cache_t> paint_cache;
+#endif
 };
 
 static hb_ot_font_t *
@@ -94,10 +1037,50 @@ _hb_ot_font_destroy (void *font_data)
     cache->fini ();
     hb_free (cache);
   }
+  hb_free (ot_font->extents_cache.get_relaxed ());
+
+#ifndef HB_NO_VAR
+  ot_font->gvar_scalars.fini ();
+  ot_font->hvar_scalars.fini ();
+  ot_font->vvar_scalars.fini ();
+  ot_font->mvar_scalars.fini ();
+#endif
+
+#ifndef HB_NO_DRAW
+  _hb_ot_font_outline_cache_destroy (ot_font->outline_cache.get_relaxed ());
+#endif
+
+#if !defined(HB_NO_PAINT) && !defined(HB_NO_COLOR)
+  _hb_ot_font_paint_cache_destroy (ot_font->paint_cache.get_relaxed ());
+#endif
 
   hb_free (ot_font);
 }
 
+/* Returns the gvar shared tuple scalars at the font's current coords,
+ * or nullptr if not available. */
+static const OT::gvar_accelerator_t::cache_t *
+_hb_ot_font_get_gvar_cache (const hb_ot_font_t *ot_font, hb_font_t *font)
+{
+#ifndef HB_NO_VAR
+  return ot_font->gvar_scalars.get (*ot_font->ot_face->gvar, font);
+#else
+  return nullptr;
+#endif
+}
+
+/* Returns the region scalars of MVAR's variation store at the font's
+ * current coords, or nullptr if not available. */
+static OT::VariationStore::cache_t *
+_hb_ot_font_get_mvar_cache (const hb_ot_font_t *ot_font, hb_font_t *font)
+{
+#ifndef HB_NO_VAR
+  return ot_font->mvar_scalars.get (ot_font->ot_face->MVAR->get_var_store (), font);
+#else
+  return nullptr;
+#endif
+}
+
 static hb_bool_t
 hb_ot_get_nominal_glyph (hb_font_t *font HB_UNUSED,
 			 void *font_data,
@@ -156,7 +1139,7 @@ hb_ot_get_glyph_h_advances (hb_font_t* font, void* font_data,
 #ifndef HB_NO_VAR
   const OT::HVAR &HVAR = *hmtx.var_table;
   const OT::VariationStore &varStore = &HVAR + HVAR.varStore;
-  OT::VariationStore::cache_t *varStore_cache = font->num_coords * count >= 128 ? varStore.create_cache () : nullptr;
+  OT::VariationStore::cache_t *varStore_cache = ot_font->hvar_scalars.get (varStore, font);
 
   bool use_cache = font->num_coords;
 #else
@@ -222,10 +1205,6 @@ hb_ot_get_glyph_h_advances (hb_font_t* font, void* font_data,
       first_advance = &StructAtOffsetUnaligned<hb_position_t> (first_advance, advance_stride);
     }
   }
-
-#ifndef HB_NO_VAR
-  OT::VariationStore::destroy_cache (varStore_cache);
-#endif
 }
 
 #ifndef HB_NO_VERTICAL
@@ -247,7 +1226,7 @@ hb_ot_get_glyph_v_advances (hb_font_t* font, void* font_data,
 #ifndef HB_NO_VAR
     const OT::VVAR &VVAR = *vmtx.var_table;
     const OT::VariationStore &varStore = &VVAR + VVAR.varStore;
-    OT::VariationStore::cache_t *varStore_cache = font->num_coords ? varStore.create_cache () : nullptr;
+    OT::VariationStore::cache_t *varStore_cache = ot_font->vvar_scalars.get (varStore, font);
 #else
     OT::VariationStore::cache_t *varStore_cache = nullptr;
 #endif
@@ -258,10 +1237,6 @@ hb_ot_get_glyph_v_advances (hb_font_t* font, void* font_data,
       first_glyph = &StructAtOffsetUnaligned<hb_codepoint_t> (first_glyph, glyph_stride);
       first_advance = &StructAtOffsetUnaligned<hb_position_t> (first_advance, advance_stride);
     }
-
-#ifndef HB_NO_VAR
-    OT::VariationStore::destroy_cache (varStore_cache);
-#endif
   }
   else
   {
@@ -304,7 +1279,8 @@ hb_ot_get_glyph_v_origin (hb_font_t *font,
     if (font->num_coords)
       VVAR.get_vorg_delta_unscaled (glyph,
 				    font->coords, font->num_coords,
-				    &delta);
+				    &delta,
+				    ot_font->vvar_scalars.get (&VVAR + VVAR.varStore, font));
 #endif
 
     *y = font->em_scalef_y (VORG.get_y_origin (glyph) + delta);
@@ -355,13 +1331,52 @@ hb_ot_get_glyph_extents (hb_font_t *font,
 #if !defined(HB_NO_COLOR)
   if (ot_face->COLR->get_extents (font, glyph, extents)) return true;
 #endif
-  if (ot_face->glyf->get_extents (font, glyph, extents)) return true;
+
+  /* Outline extents are cached unscaled, so only a coords change
+   * invalidates them. */
+  hb_ot_font_extents_cache_t *cache;
+retry:
+  cache = ot_font->extents_cache.get_acquire ();
+  if (unlikely (!cache))
+  {
+    cache = (hb_ot_font_extents_cache_t *) hb_malloc (sizeof (hb_ot_font_extents_cache_t));
+    if (likely (cache))
+    {
+      cache->init ();
+      if (unlikely (!ot_font->extents_cache.cmpexch (nullptr, cache)))
+      {
+	hb_free (cache);
+	goto retry;
+      }
+      ot_font->extents_cached_coords_serial.set_release (font->serial_coords);
+    }
+  }
+  else if (ot_font->extents_cached_coords_serial.get_acquire () != (int) font->serial_coords)
+  {
+    cache->init ();
+    ot_font->extents_cached_coords_serial.set_release (font->serial_coords);
+  }
+
+  if (cache && cache->get (glyph, extents))
+  {
+    font->scale_glyph_extents (extents);
+    return true;
+  }
+
+  *extents = {0};
+  if (!(ot_face->glyf->get_extents (font, glyph, extents,
+				    _hb_ot_font_get_gvar_cache (ot_font, font), false)
 #ifndef HB_NO_OT_FONT_CFF
-  if (ot_face->cff1->get_extents (font, glyph, extents)) return true;
-  if (ot_face->cff2->get_extents (font, glyph, extents)) return true;
+	|| ot_face->cff1->get_extents (font, glyph, extents, false)
+	|| ot_face->cff2->get_extents (font, glyph, extents, false)
 #endif
+     ))
+    return false;
 
-  return false;
+  if (cache)
+    cache->set (glyph, *extents);
+  font->scale_glyph_extents (extents);
+  return true;
 }
 
 #ifndef HB_NO_OT_FONT_GLYPH_NAMES
@@ -401,38 +1416,54 @@ hb_ot_get_glyph_from_name (hb_font_t *font HB_UNUSED,
 
 static hb_bool_t
 hb_ot_get_font_h_extents (hb_font_t *font,
-			  void *font_data HB_UNUSED,
+			  void *font_data,
 			  hb_font_extents_t *metrics,
 			  void *user_data HB_UNUSED)
 {
-  return _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_HORIZONTAL_ASCENDER, &metrics->ascender) &&
-	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_HORIZONTAL_DESCENDER, &metrics->descender) &&
-	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_HORIZONTAL_LINE_GAP, &metrics->line_gap);
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  OT::VariationStore::cache_t *mvar_cache = _hb_ot_font_get_mvar_cache (ot_font, font);
+
+  return _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_HORIZONTAL_ASCENDER, &metrics->ascender, mvar_cache) &&
+	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_HORIZONTAL_DESCENDER, &metrics->descender, mvar_cache) &&
+	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_HORIZONTAL_LINE_GAP, &metrics->line_gap, mvar_cache);
 }
 
 #ifndef HB_NO_VERTICAL
 static hb_bool_t
 hb_ot_get_font_v_extents (hb_font_t *font,
-			  void *font_data HB_UNUSED,
+			  void *font_data,
 			  hb_font_extents_t *metrics,
 			  void *user_data HB_UNUSED)
 {
-  return _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_VERTICAL_ASCENDER, &metrics->ascender) &&
-	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_VERTICAL_DESCENDER, &metrics->descender) &&
-	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_VERTICAL_LINE_GAP, &metrics->line_gap);
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  OT::VariationStore::cache_t *mvar_cache = _hb_ot_font_get_mvar_cache (ot_font, font);
+
+  return _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_VERTICAL_ASCENDER, &metrics->ascender, mvar_cache) &&
+	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_VERTICAL_DESCENDER, &metrics->descender, mvar_cache) &&
+	 _hb_ot_metrics_get_position_common (font, HB_OT_METRICS_TAG_VERTICAL_LINE_GAP, &metrics->line_gap, mvar_cache);
 }
 #endif
 
 #ifndef HB_NO_DRAW
 static void
 hb_ot_draw_glyph (hb_font_t *font,
-		  void *font_data HB_UNUSED,
+		  void *font_data,
 		  hb_codepoint_t glyph,
 		  hb_draw_funcs_t *draw_funcs, void *draw_data,
 		  void *user_data)
 {
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
   hb_draw_session_t draw_session (draw_funcs, draw_data, font->slant_xy);
-  if (font->face->table.glyf->get_path (font, glyph, draw_session)) return;
+  hb_ot_font_outline_cache_t *outline_cache = ot_font->outline_cache.get_acquire ();
+  hb_ot_font_outline_t *outline = outline_cache ? outline_cache->get_outline (font, glyph) : nullptr;
+  if (outline)
+  {
+    outline->replay (font, draw_session);
+    outline->destroy ();
+    return;
+  }
+  if (font->face->table.glyf->get_path (font, glyph, draw_session,
+					_hb_ot_font_get_gvar_cache (ot_font, font))) return;
 #ifndef HB_NO_CFF
   if (font->face->table.cff1->get_path (font, glyph, draw_session)) return;
   if (font->face->table.cff2->get_path (font, glyph, draw_session)) return;
@@ -451,7 +1482,18 @@ hb_ot_paint_glyph (hb_font_t *font,
                    void *user_data)
 {
 #ifndef HB_NO_COLOR
-  if (font->face->table.COLR->paint_glyph (font, glyph, paint_funcs, paint_data, palette, foreground)) return;
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  hb_ot_font_paint_cache_t *paint_cache = ot_font->paint_cache.get_acquire ();
+  hb_ot_font_paint_program_t *program = paint_cache ? paint_cache->get_program (font, glyph, palette, foreground) : nullptr;
+  if (program)
+  {
+    bool painted = program->painted;
+    if (painted)
+      program->replay (font, paint_funcs, paint_data);
+    program->destroy ();
+    if (painted) return;
+  }
+  else if (font->face->table.COLR->paint_glyph (font, glyph, paint_funcs, paint_data, palette, foreground)) return;
   if (font->face->table.SVG->paint_glyph (font, glyph, paint_funcs, paint_data)) return;
 #ifndef HB_NO_OT_FONT_BITMAP
   if (font->face->table.CBDT->paint_glyph (font, glyph, paint_funcs, paint_data)) return;
@@ -546,6 +1588,280 @@ hb_ot_font_set_funcs (hb_font_t *font)
 		     _hb_ot_font_destroy);
 }
 
+/**
+ * hb_ot_font_set_outline_cache_capacity:
+ * @font: #hb_font_t to work upon
+ * @capacity: maximum number of glyph outlines to cache, or zero to
+ * disable the cache
+ *
+ * Enables caching of the glyph outlines drawn with hb_font_draw_glyph()
+ * on @font, keeping up to @capacity outlines.  Outlines are cached
+ * unscaled, so they stay valid when the scale or synthetic slant of @font
+ * changes, and are dropped when its variation coordinates change.  This
+ * helps clients that draw the same glyphs repeatedly, for example
+ * rasterizing text at many sizes, or at one variation instance at a time.
+ *
+ * The cache is disabled by default.  This function resets the cache and
+ * its statistics.  It has no effect if @font is not using the OpenType
+ * font functions set by hb_ot_font_set_funcs().
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_ot_font_set_outline_cache_capacity (hb_font_t    *font,
+				       unsigned int  capacity)
+{
+#ifndef HB_NO_DRAW
+  if (hb_object_is_immutable (font))
+    return;
+  if (font->klass != _hb_ot_get_font_funcs ())
+    return;
+
+  hb_ot_font_t *ot_font = (hb_ot_font_t *) font->user_data;
+
+  hb_ot_font_outline_cache_t *cache = nullptr;
+  if (capacity)
+  {
+    cache = (hb_ot_font_outline_cache_t *) hb_calloc (1, sizeof (hb_ot_font_outline_cache_t));
+    if (unlikely (!cache))
+      return;
+    if (unlikely (!cache->init (font->face, capacity)))
+    {
+      _hb_ot_font_outline_cache_destroy (cache);
+      return;
+    }
+  }
+
+  _hb_ot_font_outline_cache_destroy (ot_font->outline_cache.get_relaxed ());
+  ot_font->outline_cache.set_relaxed (cache);
+#endif
+}
+
+/**
+ * hb_ot_font_get_outline_cache_capacity:
+ * @font: #hb_font_t to work upon
+ *
+ * Fetches the capacity of the glyph outline cache of @font, as set by
+ * hb_ot_font_set_outline_cache_capacity().
+ *
+ * Return value: The maximum number of cached glyph outlines, or zero
+ * if the cache is disabled
+ *
+ * Since: REPLACEME
+ **/
+unsigned int
+hb_ot_font_get_outline_cache_capacity (hb_font_t *font)
+{
+#ifndef HB_NO_DRAW
+  if (font->klass != _hb_ot_get_font_funcs ())
+    return 0;
+
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font->user_data;
+  hb_ot_font_outline_cache_t *cache = ot_font->outline_cache.get_acquire ();
+  return cache ? cache->capacity : 0;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * hb_ot_font_get_outline_cache_stats:
+ * @font: #hb_font_t to work upon
+ * @hits: (out) (optional): number of glyphs drawn from the cache
+ * @misses: (out) (optional): number of glyphs drawn from the font data
+ *
+ * Fetches the hit and miss counts of the glyph outline cache of @font
+ * since it was enabled with hb_ot_font_set_outline_cache_capacity().
+ * Both are zero if the cache is disabled.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_ot_font_get_outline_cache_stats (hb_font_t    *font,
+				    unsigned int *hits,   /* OUT */
+				    unsigned int *misses  /* OUT */)
+{
+  if (hits) *hits = 0;
+  if (misses) *misses = 0;
+#ifndef HB_NO_DRAW
+  if (font->klass != _hb_ot_get_font_funcs ())
+    return;
+
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font->user_data;
+  hb_ot_font_outline_cache_t *cache = ot_font->outline_cache.get_acquire ();
+  if (cache)
+    cache->get_stats (hits, misses);
+#endif
+}
+
+/**
+ * hb_ot_font_set_paint_cache_capacity:
+ * @font: #hb_font_t to work upon
+ * @capacity: maximum number of color glyphs to cache, or zero to
+ * disable the cache
+ *
+ * Enables caching of the COLR color glyphs painted with
+ * hb_font_paint_glyph() on @font, keeping up to @capacity glyphs.  The
+ * first time a glyph is painted, its paint graph is evaluated into a flat
+ * list of paint calls, with colors resolved for the palette and foreground
+ * color passed in, and with its clip box or computed clip extents in place.
+ * Later calls for the same glyph, palette and foreground replay that list
+ * into the paint functions directly.  The cache is emptied whenever @font
+ * changes, for example when its scale or variation coordinates are set.
+ *
+ * The cache is disabled by default.  This function resets the cache and
+ * its statistics.  It has no effect if @font is not using the OpenType
+ * font functions set by hb_ot_font_set_funcs().
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_ot_font_set_paint_cache_capacity (hb_font_t    *font,
+				     unsigned int  capacity)
+{
+#if !defined(HB_NO_PAINT) && !defined(HB_NO_COLOR)
+  if (hb_object_is_immutable (font))
+    return;
+  if (font->klass != _hb_ot_get_font_funcs ())
+    return;
+
+  hb_ot_font_t *ot_font = (hb_ot_font_t *) font->user_data;
+
+  hb_ot_font_paint_cache_t *cache = nullptr;
+  if (capacity)
+  {
+    cache = (hb_ot_font_paint_cache_t *) hb_calloc (1, sizeof (hb_ot_font_paint_cache_t));
+    if (unlikely (!cache))
+      return;
+    cache->init (capacity);
+  }
+
+  _hb_ot_font_paint_cache_destroy (ot_font->paint_cache.get_relaxed ());
+  ot_font->paint_cache.set_relaxed (cache);
+#endif
+}
+
+/**
+ * hb_ot_font_get_paint_cache_capacity:
+ * @font: #hb_font_t to work upon
+ *
+ * Fetches the capacity of the color glyph paint cache of @font, as set by
+ * hb_ot_font_set_paint_cache_capacity().
+ *
+ * Return value: The maximum number of cached color glyphs, or zero
+ * if the cache is disabled
+ *
+ * Since: REPLACEME
+ **/
+unsigned int
+hb_ot_font_get_paint_cache_capacity (hb_font_t *font)
+{
+#if !defined(HB_NO_PAINT) && !defined(HB_NO_COLOR)
+  if (font->klass != _hb_ot_get_font_funcs ())
+    return 0;
+
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font->user_data;
+  hb_ot_font_paint_cache_t *cache = ot_font->paint_cache.get_acquire ();
+  return cache ? cache->capacity : 0;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * hb_ot_font_get_paint_cache_stats:
+ * @font: #hb_font_t to work upon
+ * @hits: (out) (optional): number of glyphs painted from the cache
+ * @misses: (out) (optional): number of glyphs painted from the font data
+ *
+ * Fetches the hit and miss counts of the color glyph paint cache of @font
+ * since it was enabled with hb_ot_font_set_paint_cache_capacity().
+ * Both are zero if the cache is disabled.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_ot_font_get_paint_cache_stats (hb_font_t    *font,
+				  unsigned int *hits,   /* OUT */
+				  unsigned int *misses  /* OUT */)
+{
+  if (hits) *hits = 0;
+  if (misses) *misses = 0;
+#if !defined(HB_NO_PAINT) && !defined(HB_NO_COLOR)
+  if (font->klass != _hb_ot_get_font_funcs ())
+    return;
+
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font->user_data;
+  hb_ot_font_paint_cache_t *cache = ot_font->paint_cache.get_acquire ();
+  if (cache)
+    cache->get_stats (hits, misses);
+#endif
+}
+
+/**
+ * hb_ot_face_set_charstring_cache_max_size:
+ * @face: #hb_face_t to work upon
+ * @max_size: maximum size of the cache in bytes, or zero to disable
+ * the cache
+ *
+ * Enables caching of compiled CFF and CFF2 charstrings of @face.  Each
+ * glyph whose extents or outline is requested through the OpenType font
+ * functions is interpreted once, with its subroutines and variation
+ * blends resolved, and the resulting path is reused by later glyph
+ * extents and drawing calls on any font of @face.  For CFF2, glyphs are
+ * cached per set of variation coordinates, for a few sets at a time.
+ * The cache is emptied whenever a glyph would push it over @max_size,
+ * or would need one more set of coordinates than it keeps.
+ *
+ * The cache is disabled by default.  Shrinking @max_size below the
+ * current size of the cache empties it.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_ot_face_set_charstring_cache_max_size (hb_face_t    *face,
+					  unsigned int  max_size)
+{
+#ifndef HB_NO_OT_FONT_CFF
+  max_size = hb_min (max_size, (unsigned) INT_MAX);
+  /* The accelerators are shared Null objects for the empty face. */
+  if (face->table.cff1)
+    face->table.cff1->charstring_cache.set_max_size (max_size);
+  if (face->table.cff2)
+    face->table.cff2->charstring_cache.set_max_size (max_size);
+#endif
+}
+
+/**
+ * hb_ot_face_get_charstring_cache_stats:
+ * @face: #hb_face_t to work upon
+ * @hits: (out) (optional): number of glyphs served from the cache
+ * @misses: (out) (optional): number of glyphs compiled into the cache
+ * @size: (out) (optional): current size of the cache in bytes
+ *
+ * Fetches statistics of the charstring cache of @face, as enabled with
+ * hb_ot_face_set_charstring_cache_max_size().  All are zero if the cache
+ * was never enabled.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_ot_face_get_charstring_cache_stats (hb_face_t    *face,
+				       unsigned int *hits,   /* OUT */
+				       unsigned int *misses, /* OUT */
+				       unsigned int *size    /* OUT */)
+{
+  if (hits) *hits = 0;
+  if (misses) *misses = 0;
+  if (size) *size = 0;
+#ifndef HB_NO_OT_FONT_CFF
+  if (face->table.cff1)
+    face->table.cff1->charstring_cache.get_stats (hits, misses, size);
+  if (face->table.cff2)
+    face->table.cff2->charstring_cache.get_stats (hits, misses, size);
+#endif
+}
+
 #ifndef HB_NO_VAR
 bool
 _glyf_get_leading_bearing_with_var_unscaled (hb_font_t *font, hb_codepoint_t glyph, bool is_vertical,
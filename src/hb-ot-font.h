@@ -39,6 +39,40 @@ HB_BEGIN_DECLS
 HB_EXTERN void
 hb_ot_font_set_funcs (hb_font_t *font);
 
+HB_EXTERN void
+hb_ot_font_set_outline_cache_capacity (hb_font_t    *font,
+				       unsigned int  capacity);
+
+HB_EXTERN unsigned int
+hb_ot_font_get_outline_cache_capacity (hb_font_t *font);
+
+HB_EXTERN void
+hb_ot_font_get_outline_cache_stats (hb_font_t    *font,
+				    unsigned int *hits,   /* OUT */
+				    unsigned int *misses  /* OUT */);
+
+HB_EXTERN void
+hb_ot_font_set_paint_cache_capacity (hb_font_t    *font,
+				     unsigned int  capacity);
+
+HB_EXTERN unsigned int
+hb_ot_font_get_paint_cache_capacity (hb_font_t *font);
+
+HB_EXTERN void
+hb_ot_font_get_paint_cache_stats (hb_font_t    *font,
+				  unsigned int *hits,   /* OUT */
+				  unsigned int *misses  /* OUT */);
+
+HB_EXTERN void
+hb_ot_face_set_charstring_cache_max_size (hb_face_t    *face,
+					  unsigned int  max_size);
+
+HB_EXTERN void
+hb_ot_face_get_charstring_cache_stats (hb_face_t    *face,
+				       unsigned int *hits,   /* OUT */
+				       unsigned int *misses, /* OUT */
+				       unsigned int *size    /* OUT */);
+
 
 HB_END_DECLS
 
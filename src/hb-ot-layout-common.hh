@@ -2650,6 +2650,16 @@ struct VariationStore
     return cache;
   }
 
+  /* Evaluates all regions at coords up front, for caches that are shared
+   * and hence must not be filled lazily during lookups. */
+  void fill_cache (cache_t *cache, hb_array_t<int> coords) const
+  {
+    auto &r = this+regions;
+    unsigned count = r.regionCount;
+    for (unsigned i = 0; i < count; i++)
+      cache[i] = r.evaluate (i, coords.arrayZ, coords.length);
+  }
+
   static void destroy_cache (cache_t *cache) { hb_free (cache); }
 
   private:
@@ -3279,6 +3289,9 @@ struct FeatureVariations
     {
       c->cur_record_idx = i;
       varRecords[i].collect_feature_substitutes_with_variations (c, this);
+      /* The first record whose conditions are all met at the pinned location
+       * always wins, so the records after it can never apply. */
+      if (!c->apply) break;
     }
   }
 
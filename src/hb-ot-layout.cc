@@ -1505,12 +1505,21 @@ void
 hb_ot_layout_lookups_substitute_closure (hb_face_t      *face,
 					 const hb_set_t *lookups,
 					 hb_set_t       *glyphs /* OUT */)
+{
+  hb_ot_layout_lookups_substitute_closure_complete (face, lookups, glyphs);
+}
+
+bool
+hb_ot_layout_lookups_substitute_closure_complete (hb_face_t      *face,
+						  const hb_set_t *lookups,
+						  hb_set_t       *glyphs /* OUT */)
 {
   hb_map_t done_lookups_glyph_count;
   hb_hashmap_t<unsigned, hb::unique_ptr<hb_set_t>> done_lookups_glyph_set;
   OT::hb_closure_context_t c (face, glyphs, &done_lookups_glyph_count, &done_lookups_glyph_set);
   const GSUB& gsub = *face->table.GSUB->table;
 
+  bool complete = true;
   unsigned int iteration_count = 0;
   unsigned int glyphs_length;
   do
@@ -1527,8 +1536,16 @@ hb_ot_layout_lookups_substitute_closure (hb_face_t      *face,
       for (unsigned int i = 0; i < gsub.get_lookup_count (); i++)
 	gsub.get_lookup (i).closure (&c, i);
     }
+    if (unlikely (c.lookup_limit_exceeded ()))
+      complete = false;
   } while (iteration_count++ <= HB_CLOSURE_MAX_STAGES &&
 	   glyphs_length != glyphs->get_population ());
+
+  return complete &&
+	 glyphs_length == glyphs->get_population () &&
+	 !glyphs->in_error () &&
+	 !done_lookups_glyph_count.in_error () &&
+	 !done_lookups_glyph_set.in_error ();
 }
 
 /*
@@ -1919,7 +1936,8 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
        * (plus some past glyphs).
        *
        * Only try applying the lookup if there is any overlap. */
-      if (proxy.accels[lookup_index].digest.may_have (c.digest))
+      if (proxy.accels[lookup_index].digest.may_have (c.digest) &&
+	  (lookup.ascii || !(buffer->scratch_flags & HB_BUFFER_SCRATCH_FLAG_ASCII_FAST_PATH)))
       {
 	c.set_lookup_index (lookup_index);
 	c.set_lookup_mask (lookup.mask);
@@ -1949,6 +1967,24 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
   }
 }
 
+/* Mark the lookups that can match any sequence of glyphs from @glyphs.  While
+ * the ASCII fast path is on for a buffer, all its glyphs are known to be in
+ * that set, so the other lookups are skipped without looking at the buffer.
+ *
+ * A skipped lookup could still have marked glyphs unsafe-to-concat while
+ * failing to match, so buffers that produce those flags don't take the fast
+ * path. */
+void hb_ot_map_t::set_ascii_glyphs (hb_face_t *face, const hb_set_t *glyphs)
+{
+  const GSUB &gsub = *face->table.GSUB->table;
+  for (auto &lookup : lookups[0])
+    lookup.ascii = gsub.get_lookup (lookup.index).intersects (glyphs);
+
+  const GPOS &gpos = *face->table.GPOS->table;
+  for (auto &lookup : lookups[1])
+    lookup.ascii = gpos.get_lookup (lookup.index).intersects (glyphs);
+}
+
 void hb_ot_map_t::substitute (const hb_ot_shape_plan_t *plan, hb_font_t *font, hb_buffer_t *buffer) const
 {
   GSUBProxy proxy (font->face);
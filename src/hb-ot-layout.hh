@@ -68,6 +68,13 @@ hb_ot_layout_table_find_feature (hb_face_t    *face,
 				 hb_tag_t      feature_tag,
 				 unsigned int *feature_index);
 
+/* Like hb_ot_layout_lookups_substitute_closure(), but returns false if the
+ * closure stopped at one of its limits before converging. */
+HB_INTERNAL bool
+hb_ot_layout_lookups_substitute_closure_complete (hb_face_t      *face,
+						  const hb_set_t *lookups,
+						  hb_set_t       *glyphs /* OUT */);
+
 
 /*
  * GDEF
@@ -200,21 +207,26 @@ enum hb_unicode_props_flags_t {
 };
 HB_MARK_AS_FLAG_T (hb_unicode_props_flags_t);
 
+/* Fills in the rest of the Unicode props of @info, whose props hold the
+ * general category and, for marks, the combining class, as written by
+ * hb_unicode_funcs_t::props_bulk(). */
 static inline void
-_hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
+_hb_glyph_info_complete_unicode_props (hb_glyph_info_t           *info,
+				       hb_unicode_funcs_t        *unicode,
+				       hb_buffer_scratch_flags_t &scratch_flags)
 {
-  hb_unicode_funcs_t *unicode = buffer->unicode;
   unsigned int u = info->codepoint;
-  unsigned int gen_cat = (unsigned int) unicode->general_category (u);
+  unsigned int gen_cat = info->unicode_props() & 0xFFu;
+  unsigned int combining_class = info->unicode_props() >> 8;
   unsigned int props = gen_cat;
 
   if (u >= 0x80u)
   {
-    buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_NON_ASCII;
+    scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_NON_ASCII;
 
     if (unlikely (unicode->is_default_ignorable (u)))
     {
-      buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_DEFAULT_IGNORABLES;
+      scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_DEFAULT_IGNORABLES;
       props |=  UPROPS_MASK_IGNORABLE;
       if (u == 0x200Cu) props |= UPROPS_MASK_Cf_ZWNJ;
       else if (u == 0x200Du) props |= UPROPS_MASK_Cf_ZWJ;
@@ -233,7 +245,7 @@ _hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
        * https://github.com/harfbuzz/harfbuzz/issues/554 */
       else if (unlikely (u == 0x034Fu))
       {
-	buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_CGJ;
+	scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_CGJ;
 	props |= UPROPS_MASK_HIDDEN;
       }
     }
@@ -241,13 +253,20 @@ _hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
     if (unlikely (HB_UNICODE_GENERAL_CATEGORY_IS_MARK (gen_cat)))
     {
       props |= UPROPS_MASK_CONTINUATION;
-      props |= unicode->modified_combining_class (u)<<8;
+      props |= unicode->modified_combining_class (u, combining_class)<<8;
     }
   }
 
   info->unicode_props() = props;
 }
 
+static inline void
+_hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
+{
+  buffer->unicode->props_bulk (1, &info->codepoint, 0, &info->unicode_props(), 0);
+  _hb_glyph_info_complete_unicode_props (info, buffer->unicode, buffer->scratch_flags);
+}
+
 static inline void
 _hb_glyph_info_set_general_category (hb_glyph_info_t *info,
 				     hb_unicode_general_category_t gen_cat)
@@ -68,6 +68,7 @@ struct hb_ot_map_t
     unsigned short auto_zwj : 1;
     unsigned short random : 1;
     unsigned short per_syllable : 1;
+    unsigned short ascii : 1; /* May apply to the plan's ASCII glyph closure. */
     hb_mask_t mask;
     hb_tag_t feature_tag;
 
@@ -154,6 +155,7 @@ struct hb_ot_map_t
   }
 
   HB_INTERNAL void collect_lookups (unsigned int table_index, hb_set_t *lookups) const;
+  HB_INTERNAL void set_ascii_glyphs (hb_face_t *face, const hb_set_t *glyphs);
   template <typename Proxy>
   HB_INTERNAL void apply (const Proxy &proxy,
 			  const struct hb_ot_shape_plan_t *plan, hb_font_t *font, hb_buffer_t *buffer) const;
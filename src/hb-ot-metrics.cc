@@ -59,15 +59,16 @@ _fix_ascender_descender (float value, hb_ot_metrics_tag_t metrics_tag)
 bool
 _hb_ot_metrics_get_position_common (hb_font_t           *font,
 				    hb_ot_metrics_tag_t  metrics_tag,
-				    hb_position_t       *position     /* OUT.  May be NULL. */)
+				    hb_position_t       *position,    /* OUT.  May be NULL. */
+				    float               *mvar_cache)
 {
   hb_face_t *face = font->face;
   switch ((unsigned) metrics_tag)
   {
 #ifndef HB_NO_VAR
-#define GET_VAR face->table.MVAR->get_var (metrics_tag, font->coords, font->num_coords)
+#define GET_VAR face->table.MVAR->get_var (metrics_tag, font->coords, font->num_coords, mvar_cache)
 #else
-#define GET_VAR .0f
+#define GET_VAR ((void) mvar_cache, .0f)
 #endif
 #define GET_METRIC_X(TABLE, ATTR) \
   (face->table.TABLE->has_data () && \
@@ -30,6 +30,7 @@
 HB_INTERNAL bool
 _hb_ot_metrics_get_position_common (hb_font_t           *font,
 				    hb_ot_metrics_tag_t  metrics_tag,
-				    hb_position_t       *position     /* OUT.  May be NULL. */);
+				    hb_position_t       *position,    /* OUT.  May be NULL. */
+				    float               *mvar_cache = nullptr /* Region scalars of MVAR's store at the font's coords. */);
 
 #endif /* HB_OT_METRICS_HH */
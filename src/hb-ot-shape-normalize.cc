@@ -425,10 +425,26 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
 
   /* Third round, recompose */
 
+  bool might_compose = false;
   if (!all_simple &&
       buffer->successful &&
       (mode == HB_OT_SHAPE_NORMALIZATION_MODE_COMPOSED_DIACRITICS ||
        mode == HB_OT_SHAPE_NORMALIZATION_MODE_COMPOSED_DIACRITICS_NO_SHORT_CIRCUIT))
+  {
+    /* Most runs, already NFC or in scripts without canonical compositions,
+     * have no mark that can compose with anything before it.  Skip the
+     * round for those. */
+    count = buffer->len;
+    for (unsigned int i = 1; i < count; i++)
+      if (_hb_glyph_info_is_unicode_mark (&buffer->info[i]) &&
+	  buffer->unicode->may_compose_with_previous (buffer->info[i].codepoint))
+      {
+	might_compose = true;
+	break;
+      }
+  }
+
+  if (might_compose)
   {
     /* As noted in the comment earlier, we don't try to combine
      * ccc=0 chars with their previous Starter. */
@@ -450,6 +466,8 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
 	     * smaller than this character's. */
 	    (starter == buffer->out_len - 1 ||
 	     info_cc (buffer->prev()) < info_cc (buffer->cur())) &&
+	    /* And it can compose at all. */
+	    buffer->unicode->may_compose_with_previous (buffer->cur().codepoint) &&
 	    /* And compose. */
 	    c.compose (&c,
 		       buffer->out_info[starter].codepoint,
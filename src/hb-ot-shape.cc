@@ -38,10 +38,12 @@
 
 #include "hb-ot-shape.hh"
 #include "hb-ot-shaper.hh"
+#include "hb-ot-shaper-arabic.hh"
 #include "hb-ot-shape-fallback.hh"
 #include "hb-ot-shape-normalize.hh"
 
 #include "hb-ot-face.hh"
+#include "hb-ot-cmap-table.hh"
 
 #include "hb-set.hh"
 
@@ -212,6 +214,72 @@ hb_ot_shape_planner_t::compile (hb_ot_shape_plan_t           &plan,
 #endif
 }
 
+
+/*
+ * ASCII fast path.
+ *
+ * Text that is all ASCII, shaped with the default shaper, does not need
+ * most of the generic machinery: no character is a mark, a default-ignorable
+ * or decomposable, and the glyphs can only ever be the ones reachable from
+ * the ASCII glyphs through the plan's GSUB lookups.  At plan time we compute
+ * that glyph closure and mark the GSUB/GPOS lookups that can match it; at
+ * shape time, a buffer that qualifies gets its Unicode properties from a
+ * table, its glyphs mapped in one go instead of normalized, and skips all
+ * other lookups.  Buffers that ask for unsafe-to-concat flags never qualify.
+ * Builds with HB_DEBUG_SHAPE_PLAN trace each time the fast path is taken.
+ */
+
+static void
+hb_ot_shape_setup_ascii_fast_path (hb_ot_shape_plan_t *plan,
+				   hb_face_t          *face)
+{
+  if (plan->shaper != &_hb_ot_shaper_default || plan->apply_morx)
+    return;
+
+  /* Only bother for the scripts ASCII text is itemized as. */
+  switch ((int) plan->props.script)
+  {
+    case HB_SCRIPT_LATIN:
+    case HB_SCRIPT_COMMON:
+    case HB_SCRIPT_INHERITED:
+    case HB_SCRIPT_UNKNOWN:
+    case HB_SCRIPT_INVALID:
+      break;
+    default:
+      return;
+  }
+
+  /* The ASCII general category table is only used with the default Unicode
+   * functions; make sure it agrees with them. */
+  hb_unicode_funcs_t *unicode = hb_unicode_funcs_get_default ();
+  for (hb_codepoint_t u = 0; u < 0x80u; u++)
+    if (unicode->general_category (u) != _hb_ascii_general_category[u])
+      return;
+
+  hb_set_t *glyphs = hb_set_create ();
+  for (hb_codepoint_t u = 0; u < 0x80u; u++)
+  {
+    hb_codepoint_t glyph;
+    if (face->table.cmap->get_nominal_glyph (u, &glyph))
+      glyphs->add (glyph);
+  }
+
+  /* The closure stops at its lookup and round limits; only use it if it
+   * actually converged. */
+  hb_set_t lookups;
+  plan->map.collect_lookups (0, &lookups);
+  if (unlikely (!hb_ot_layout_lookups_substitute_closure_complete (face, &lookups, glyphs) ||
+		lookups.in_error ()))
+  {
+    DEBUG_MSG (SHAPE_PLAN, plan, "ASCII glyph closure incomplete; no fast path");
+    hb_set_destroy (glyphs);
+    return;
+  }
+
+  plan->map.set_ascii_glyphs (face, glyphs);
+  plan->ascii_glyphs = glyphs;
+}
+
 bool
 hb_ot_shape_plan_t::init0 (hb_face_t                     *face,
 			   const hb_shape_plan_key_t     *key)
@@ -237,6 +305,9 @@ hb_ot_shape_plan_t::init0 (hb_face_t                     *face,
     }
   }
 
+  ascii_glyphs = nullptr;
+  hb_ot_shape_setup_ascii_fast_path (this, face);
+
   return true;
 }
 
@@ -246,6 +317,8 @@ hb_ot_shape_plan_t::fini ()
   if (shaper->data_destroy)
     shaper->data_destroy (const_cast<void *> (data));
 
+  hb_set_destroy (ascii_glyphs);
+
   map.fini ();
 }
 
@@ -396,17 +469,24 @@ hb_ot_shape_collect_features (hb_ot_shape_planner_t *planner,
  * shaper face data
  */
 
-struct hb_ot_face_data_t {};
-
 hb_ot_face_data_t *
-_hb_ot_shaper_face_data_create (hb_face_t *face)
+_hb_ot_shaper_face_data_create (hb_face_t *face HB_UNUSED)
 {
-  return (hb_ot_face_data_t *) HB_SHAPER_DATA_SUCCEEDED;
+  hb_ot_face_data_t *data = (hb_ot_face_data_t *) hb_calloc (1, sizeof (hb_ot_face_data_t));
+  /* Nothing in the face data is required for shaping; on allocation
+   * failure, shape without it rather than disabling the shaper. */
+  if (unlikely (!data))
+    return (hb_ot_face_data_t *) HB_SHAPER_DATA_SUCCEEDED;
+  return data;
 }
 
 void
 _hb_ot_shaper_face_data_destroy (hb_ot_face_data_t *data)
 {
+  if (data == HB_SHAPER_DATA_SUCCEEDED)
+    return;
+  data_destroy_arabic_fallback (data->arabic_fallback_plan);
+  hb_free (data);
 }
 
 
@@ -465,9 +545,15 @@ hb_set_unicode_props (hb_buffer_t *buffer)
    */
   unsigned int count = buffer->len;
   hb_glyph_info_t *info = buffer->info;
+  if (unlikely (!count)) return;
+  hb_unicode_funcs_t *unicode = buffer->unicode;
+  hb_buffer_scratch_flags_t scratch_flags = buffer->scratch_flags;
+  unicode->props_bulk (count,
+		       &info[0].codepoint, sizeof (info[0]),
+		       &info[0].unicode_props(), sizeof (info[0]));
   for (unsigned int i = 0; i < count; i++)
   {
-    _hb_glyph_info_set_unicode_props (&info[i], buffer);
+    _hb_glyph_info_complete_unicode_props (&info[i], unicode, scratch_flags);
 
     /* Marks are already set as continuation by the above line.
      * Handle Emoji_Modifier and ZWJ-continuation. */
@@ -492,7 +578,7 @@ hb_set_unicode_props (hb_buffer_t *buffer)
 	  _hb_unicode_is_emoji_Extended_Pictographic (info[i + 1].codepoint))
       {
 	i++;
-	_hb_glyph_info_set_unicode_props (&info[i], buffer);
+	_hb_glyph_info_complete_unicode_props (&info[i], unicode, scratch_flags);
 	_hb_glyph_info_set_continuation (&info[i]);
       }
     }
@@ -514,6 +600,27 @@ hb_set_unicode_props (hb_buffer_t *buffer)
     else if (unlikely (hb_in_ranges<hb_codepoint_t> (info[i].codepoint, 0xFF9Eu, 0xFF9Fu, 0xE0020u, 0xE007Fu)))
       _hb_glyph_info_set_continuation (&info[i]);
   }
+  buffer->scratch_flags = scratch_flags;
+}
+
+static bool
+hb_set_ascii_unicode_props (const hb_ot_shape_context_t *c)
+{
+  hb_buffer_t *buffer = c->buffer;
+  if (!c->plan->ascii_glyphs ||
+      buffer->unicode != hb_unicode_funcs_get_default ())
+    return false;
+
+  unsigned int count = buffer->len;
+  hb_glyph_info_t *info = buffer->info;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    hb_codepoint_t u = info[i].codepoint;
+    if (u >= 0x80u)
+      return false;
+    info[i].unicode_props() = _hb_ascii_general_category[u];
+  }
+  return true;
 }
 
 static void
@@ -877,6 +984,41 @@ hb_synthesize_glyph_classes (hb_buffer_t *buffer)
   }
 }
 
+/* For ASCII text, where no character is a mark or decomposes, normalization
+ * reduces to mapping the characters to glyphs.  Turns the fast path on if
+ * all glyphs are in the plan's ASCII closure. */
+static bool
+hb_ot_map_ascii_glyphs (const hb_ot_shape_context_t *c)
+{
+  hb_buffer_t *buffer = c->buffer;
+  if (!c->plan->ascii_glyphs ||
+      (buffer->flags & HB_BUFFER_FLAG_PRODUCE_UNSAFE_TO_CONCAT) ||
+      (buffer->scratch_flags & HB_BUFFER_SCRATCH_FLAG_HAS_NON_ASCII) ||
+      buffer->unicode != hb_unicode_funcs_get_default ())
+    return false;
+
+  unsigned int count = buffer->len;
+  hb_glyph_info_t *info = buffer->info;
+  for (unsigned int i = 0; i < count; i++)
+    if (unlikely (info[i].codepoint >= 0x80u))
+      return false;
+
+  if (!count ||
+      c->font->get_nominal_glyphs (count,
+				   &info[0].codepoint, sizeof (info[0]),
+				   &info[0].glyph_index(), sizeof (info[0])) < count)
+    return false;
+
+  const hb_set_t *ascii_glyphs = c->plan->ascii_glyphs;
+  for (unsigned int i = 0; i < count; i++)
+    if (!ascii_glyphs->has (info[i].glyph_index()))
+      return true;
+
+  buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_ASCII_FAST_PATH;
+  DEBUG_MSG (SHAPE_PLAN, c->plan, "ASCII fast path taken for %u glyphs", count);
+  return true;
+}
+
 static inline void
 hb_ot_substitute_default (const hb_ot_shape_context_t *c)
 {
@@ -886,7 +1028,8 @@ hb_ot_substitute_default (const hb_ot_shape_context_t *c)
 
   HB_BUFFER_ALLOCATE_VAR (buffer, glyph_index);
 
-  _hb_ot_shape_normalize (c->plan, buffer, c->font);
+  if (!hb_ot_map_ascii_glyphs (c))
+    _hb_ot_shape_normalize (c->plan, buffer, c->font);
 
   hb_ot_shape_setup_masks (c);
 
@@ -1167,7 +1310,8 @@ hb_ot_shape_internal (hb_ot_shape_context_t *c)
   _hb_buffer_allocate_unicode_vars (c->buffer);
 
   hb_ot_shape_initialize_masks (c);
-  hb_set_unicode_props (c->buffer);
+  if (!hb_set_ascii_unicode_props (c))
+    hb_set_unicode_props (c->buffer);
   hb_insert_dotted_circle (c->buffer, c->font);
 
   hb_form_clusters (c->buffer);
@@ -124,6 +124,10 @@ struct hb_ot_shape_plan_t
   static constexpr bool apply_trak = false;
 #endif
 
+  /* GSUB closure of the glyphs of ASCII characters, if the plan qualifies
+   * for the ASCII fast path; nullptr otherwise. */
+  hb_set_t *ascii_glyphs;
+
   void collect_lookups (hb_tag_t table_tag, hb_set_t *lookups) const
   {
     unsigned int table_index;
@@ -145,6 +149,16 @@ struct hb_ot_shape_plan_t
 
 struct hb_shape_plan_t;
 
+struct arabic_fallback_plan_t;
+
+/* Shaper data shared by all shape plans of a face. */
+struct hb_ot_face_data_t
+{
+  /* Lookups synthesized for Arabic fonts without GSUB shaping features,
+   * built on first use. */
+  hb_atomic_ptr_t<arabic_fallback_plan_t> arabic_fallback_plan;
+};
+
 struct hb_ot_shape_planner_t
 {
   /* In the order that they are filled in. */
@@ -51,8 +51,7 @@ static const hb_tag_t arabic_fallback_features[] =
 };
 
 static OT::SubstLookup *
-arabic_fallback_synthesize_lookup_single (const hb_ot_shape_plan_t *plan HB_UNUSED,
-					  hb_font_t *font,
+arabic_fallback_synthesize_lookup_single (hb_font_t *font,
 					  unsigned int feature_index)
 {
   OT::HBGlyphID16 glyphs[SHAPING_TABLE_LAST - SHAPING_TABLE_FIRST + 1];
@@ -103,8 +102,7 @@ arabic_fallback_synthesize_lookup_single (const hb_ot_shape_plan_t *plan HB_UNUS
 
 template <typename T>
 static OT::SubstLookup *
-arabic_fallback_synthesize_lookup_ligature (const hb_ot_shape_plan_t *plan HB_UNUSED,
-					    hb_font_t *font,
+arabic_fallback_synthesize_lookup_ligature (hb_font_t *font,
 					    const T &ligature_table,
 					    unsigned lookup_flags)
 {
@@ -195,18 +193,17 @@ arabic_fallback_synthesize_lookup_ligature (const hb_ot_shape_plan_t *plan HB_UN
 }
 
 static OT::SubstLookup *
-arabic_fallback_synthesize_lookup (const hb_ot_shape_plan_t *plan,
-				   hb_font_t *font,
+arabic_fallback_synthesize_lookup (hb_font_t *font,
 				   unsigned int feature_index)
 {
   if (feature_index < 4)
-    return arabic_fallback_synthesize_lookup_single (plan, font, feature_index);
+    return arabic_fallback_synthesize_lookup_single (font, feature_index);
   else
   {
     switch (feature_index) {
-      case 4: return arabic_fallback_synthesize_lookup_ligature (plan, font, ligature_3_table, OT::LookupFlag::IgnoreMarks);
-      case 5: return arabic_fallback_synthesize_lookup_ligature (plan, font, ligature_table, OT::LookupFlag::IgnoreMarks);
-      case 6: return arabic_fallback_synthesize_lookup_ligature (plan, font, ligature_mark_table, 0);
+      case 4: return arabic_fallback_synthesize_lookup_ligature (font, ligature_3_table, OT::LookupFlag::IgnoreMarks);
+      case 5: return arabic_fallback_synthesize_lookup_ligature (font, ligature_table, OT::LookupFlag::IgnoreMarks);
+      case 6: return arabic_fallback_synthesize_lookup_ligature (font, ligature_mark_table, 0);
     }
   }
   assert (false);
@@ -215,12 +212,15 @@ arabic_fallback_synthesize_lookup (const hb_ot_shape_plan_t *plan,
 
 #define ARABIC_FALLBACK_MAX_LOOKUPS ARRAY_LENGTH_CONST (arabic_fallback_features)
 
+/* The synthesized lookups only depend on the font's character map, so they
+ * are built once per face and shared by all its shape plans.  Each plan
+ * supplies the masks, indexed like arabic_fallback_features. */
 struct arabic_fallback_plan_t
 {
   unsigned int num_lookups;
   bool free_lookups;
 
-  hb_mask_t mask_array[ARABIC_FALLBACK_MAX_LOOKUPS];
+  unsigned int feature_index_array[ARABIC_FALLBACK_MAX_LOOKUPS];
   OT::SubstLookup *lookup_array[ARABIC_FALLBACK_MAX_LOOKUPS];
   OT::hb_ot_layout_lookup_accelerator_t accel_array[ARABIC_FALLBACK_MAX_LOOKUPS];
 };
@@ -245,7 +245,6 @@ typedef OT::Array16Of<ManifestLookup> Manifest;
 
 static bool
 arabic_fallback_plan_init_win1256 (arabic_fallback_plan_t *fallback_plan HB_UNUSED,
-				   const hb_ot_shape_plan_t *plan HB_UNUSED,
 				   hb_font_t *font HB_UNUSED)
 {
 #ifdef HB_WITH_WIN1256
@@ -266,15 +265,19 @@ arabic_fallback_plan_init_win1256 (arabic_fallback_plan_t *fallback_plan HB_UNUS
   unsigned int count = manifest.len;
   for (unsigned int i = 0; i < count; i++)
   {
-    fallback_plan->mask_array[j] = plan->map.get_1_mask (manifest[i].tag);
-    if (fallback_plan->mask_array[j])
+    unsigned int feature_index = 0;
+    while (feature_index < ARRAY_LENGTH (arabic_fallback_features) &&
+	   arabic_fallback_features[feature_index] != manifest[i].tag)
+      feature_index++;
+    if (unlikely (feature_index == ARRAY_LENGTH (arabic_fallback_features)))
+      continue;
+
+    fallback_plan->feature_index_array[j] = feature_index;
+    fallback_plan->lookup_array[j] = const_cast<OT::SubstLookup*> (&(&manifest+manifest[i].lookupOffset));
+    if (fallback_plan->lookup_array[j])
     {
-      fallback_plan->lookup_array[j] = const_cast<OT::SubstLookup*> (&(&manifest+manifest[i].lookupOffset));
-      if (fallback_plan->lookup_array[j])
-      {
-	fallback_plan->accel_array[j].init (*fallback_plan->lookup_array[j]);
-	j++;
-      }
+      fallback_plan->accel_array[j].init (*fallback_plan->lookup_array[j]);
+      j++;
     }
   }
 
@@ -289,22 +292,18 @@ arabic_fallback_plan_init_win1256 (arabic_fallback_plan_t *fallback_plan HB_UNUS
 
 static bool
 arabic_fallback_plan_init_unicode (arabic_fallback_plan_t *fallback_plan,
-				   const hb_ot_shape_plan_t *plan,
 				   hb_font_t *font)
 {
   static_assert ((ARRAY_LENGTH_CONST (arabic_fallback_features) <= ARABIC_FALLBACK_MAX_LOOKUPS), "");
   unsigned int j = 0;
   for (unsigned int i = 0; i < ARRAY_LENGTH(arabic_fallback_features) ; i++)
   {
-    fallback_plan->mask_array[j] = plan->map.get_1_mask (arabic_fallback_features[i]);
-    if (fallback_plan->mask_array[j])
+    fallback_plan->feature_index_array[j] = i;
+    fallback_plan->lookup_array[j] = arabic_fallback_synthesize_lookup (font, i);
+    if (fallback_plan->lookup_array[j])
     {
-      fallback_plan->lookup_array[j] = arabic_fallback_synthesize_lookup (plan, font, i);
-      if (fallback_plan->lookup_array[j])
-      {
-	fallback_plan->accel_array[j].init (*fallback_plan->lookup_array[j]);
-	j++;
-      }
+      fallback_plan->accel_array[j].init (*fallback_plan->lookup_array[j]);
+      j++;
     }
   }
 
@@ -315,8 +314,7 @@ arabic_fallback_plan_init_unicode (arabic_fallback_plan_t *fallback_plan,
 }
 
 static arabic_fallback_plan_t *
-arabic_fallback_plan_create (const hb_ot_shape_plan_t *plan,
-			     hb_font_t *font)
+arabic_fallback_plan_create (hb_font_t *font)
 {
   arabic_fallback_plan_t *fallback_plan = (arabic_fallback_plan_t *) hb_calloc (1, sizeof (arabic_fallback_plan_t));
   if (unlikely (!fallback_plan))
@@ -327,12 +325,12 @@ arabic_fallback_plan_create (const hb_ot_shape_plan_t *plan,
 
   /* Try synthesizing GSUB table using Unicode Arabic Presentation Forms,
    * in case the font has cmap entries for the presentation-forms characters. */
-  if (arabic_fallback_plan_init_unicode (fallback_plan, plan, font))
+  if (arabic_fallback_plan_init_unicode (fallback_plan, font))
     return fallback_plan;
 
   /* See if this looks like a Windows-1256-encoded font.  If it does, use a
    * hand-coded GSUB table. */
-  if (arabic_fallback_plan_init_win1256 (fallback_plan, plan, font))
+  if (arabic_fallback_plan_init_win1256 (fallback_plan, font))
     return fallback_plan;
 
   assert (fallback_plan->num_lookups == 0);
@@ -358,18 +356,22 @@ arabic_fallback_plan_destroy (arabic_fallback_plan_t *fallback_plan)
 }
 
 static void
-arabic_fallback_plan_shape (arabic_fallback_plan_t *fallback_plan,
+arabic_fallback_plan_shape (const arabic_fallback_plan_t *fallback_plan,
+			    const hb_mask_t *mask_array,
 			    hb_font_t *font,
 			    hb_buffer_t *buffer)
 {
   OT::hb_ot_apply_context_t c (0, font, buffer);
   for (unsigned int i = 0; i < fallback_plan->num_lookups; i++)
-    if (fallback_plan->lookup_array[i]) {
-      c.set_lookup_mask (fallback_plan->mask_array[i]);
+  {
+    hb_mask_t mask = mask_array[fallback_plan->feature_index_array[i]];
+    if (fallback_plan->lookup_array[i] && mask) {
+      c.set_lookup_mask (mask);
       hb_ot_layout_substitute_lookup (&c,
 				      *fallback_plan->lookup_array[i],
 				      fallback_plan->accel_array[i]);
     }
+  }
 }
 
 
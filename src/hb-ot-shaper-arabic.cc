@@ -85,7 +85,13 @@ enum hb_arabic_joining_type_t {
 
 static unsigned int get_joining_type (hb_codepoint_t u, hb_unicode_general_category_t gen_cat)
 {
-  unsigned int j_type = joining_type(u);
+  /* Most text is in the Arabic block; index its table range directly.  The
+   * generated range starting at U+0600 must reach past U+06FF, that is, end
+   * before the offset of the range that follows it. */
+  static_assert ((joining_offset_0x0600u + (0x06FFu - 0x0600u) < joining_offset_0x1806u), "");
+  unsigned int j_type = likely (hb_in_range<hb_codepoint_t> (u, 0x0600u, 0x06FFu)) ?
+			joining_table[u - 0x0600u + joining_offset_0x0600u] :
+			joining_type (u);
   if (likely (j_type != JOINING_TYPE_X))
     return j_type;
 
@@ -263,7 +269,8 @@ struct arabic_shape_plan_t
    * mask_array[NONE] == 0. */
   hb_mask_t mask_array[ARABIC_NUM_FEATURES + 1];
 
-  hb_atomic_ptr_t<arabic_fallback_plan_t> fallback_plan;
+  /* Masks for the face's shared fallback lookups. */
+  hb_mask_t fallback_mask_array[ARABIC_FALLBACK_MAX_LOOKUPS];
 
   unsigned int do_fallback : 1;
   unsigned int has_stch : 1;
@@ -284,6 +291,9 @@ data_create_arabic (const hb_ot_shape_plan_t *plan)
 			       (FEATURE_IS_SYRIAC (arabic_features[i]) ||
 				plan->map.needs_fallback (arabic_features[i]));
   }
+  if (arabic_plan->do_fallback)
+    for (unsigned int i = 0; i < ARRAY_LENGTH (arabic_fallback_features); i++)
+      arabic_plan->fallback_mask_array[i] = plan->map.get_1_mask (arabic_fallback_features[i]);
 
   return arabic_plan;
 }
@@ -291,13 +301,15 @@ data_create_arabic (const hb_ot_shape_plan_t *plan)
 void
 data_destroy_arabic (void *data)
 {
-  arabic_shape_plan_t *arabic_plan = (arabic_shape_plan_t *) data;
-
-  arabic_fallback_plan_destroy (arabic_plan->fallback_plan);
-
   hb_free (data);
 }
 
+void
+data_destroy_arabic_fallback (arabic_fallback_plan_t *fallback_plan)
+{
+  arabic_fallback_plan_destroy (fallback_plan);
+}
+
 static void
 arabic_joining (hb_buffer_t *buffer)
 {
@@ -318,6 +330,14 @@ arabic_joining (hb_buffer_t *buffer)
     break;
   }
 
+  /* What safe_to_insert_tatweel() sets on a joining pair.  Adjacent pairs
+   * are by far the common case; for those we set the flags inline and
+   * without branching on whether the pair joins. */
+  hb_mask_t join_flags = (buffer->flags & HB_BUFFER_FLAG_PRODUCE_SAFE_TO_INSERT_TATWEEL) ?
+			 HB_GLYPH_FLAG_SAFE_TO_INSERT_TATWEEL :
+			 HB_GLYPH_FLAG_UNSAFE_TO_BREAK | HB_GLYPH_FLAG_UNSAFE_TO_CONCAT;
+  hb_mask_t added_flags = 0;
+
   for (unsigned int i = 0; i < count; i++)
   {
     unsigned int this_type = get_joining_type (info[i].codepoint, _hb_glyph_info_get_general_category (&info[i]));
@@ -328,8 +348,26 @@ arabic_joining (hb_buffer_t *buffer)
     }
 
     const arabic_state_table_entry *entry = &arabic_state_table[state][this_type];
+    bool joins = entry->prev_action != NONE;
 
-    if (entry->prev_action != NONE && prev != UINT_MAX)
+    if (likely (i && prev == i - 1))
+    {
+      /* Same as safe_to_insert_tatweel (prev, i + 1): flag whichever
+       * glyph is not in the lower cluster. */
+      unsigned int prev_cluster = info[prev].cluster;
+      unsigned int this_cluster = info[i].cluster;
+      hb_mask_t flags = joins ? join_flags : 0;
+      info[prev].mask |= prev_cluster > this_cluster ? flags : 0;
+      info[i].mask |= this_cluster > prev_cluster ? flags : 0;
+      added_flags |= flags;
+
+      info[prev].arabic_shaping_action() = joins ? entry->prev_action : info[prev].arabic_shaping_action();
+      if (!joins &&
+	  (this_type >= JOINING_TYPE_R ||
+	   (2 <= state && state <= 5) /* States that have a possible prev_action. */))
+	buffer->unsafe_to_concat (prev, i + 1);
+    }
+    else if (joins && prev != UINT_MAX)
     {
       info[prev].arabic_shaping_action() = entry->prev_action;
       buffer->safe_to_insert_tatweel (prev, i + 1);
@@ -355,6 +393,9 @@ arabic_joining (hb_buffer_t *buffer)
     state = entry->next_state;
   }
 
+  if (added_flags)
+    buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_GLYPH_FLAGS;
+
   for (unsigned int i = 0; i < buffer->context_len[1]; i++)
   {
     unsigned int this_type = get_joining_type (buffer->context[1][i], buffer->unicode->general_category (buffer->context[1][i]));
@@ -427,20 +468,33 @@ arabic_fallback_shape (const hb_ot_shape_plan_t *plan,
   if (!arabic_plan->do_fallback)
     return false;
 
+  const hb_ot_face_data_t *face_data = font->face->data.ot;
+  if (unlikely (!face_data))
+    return false;
+
+  if (unlikely (face_data == HB_SHAPER_DATA_SUCCEEDED))
+  {
+    /* No face data to share the plan through; build one for this call. */
+    arabic_fallback_plan_t *fallback_plan = arabic_fallback_plan_create (font);
+    arabic_fallback_plan_shape (fallback_plan, arabic_plan->fallback_mask_array, font, buffer);
+    arabic_fallback_plan_destroy (fallback_plan);
+    return true;
+  }
+
 retry:
-  arabic_fallback_plan_t *fallback_plan = arabic_plan->fallback_plan;
+  arabic_fallback_plan_t *fallback_plan = face_data->arabic_fallback_plan;
   if (unlikely (!fallback_plan))
   {
     /* This sucks.  We need a font to build the fallback plan... */
-    fallback_plan = arabic_fallback_plan_create (plan, font);
-    if (unlikely (!arabic_plan->fallback_plan.cmpexch (nullptr, fallback_plan)))
+    fallback_plan = arabic_fallback_plan_create (font);
+    if (unlikely (!face_data->arabic_fallback_plan.cmpexch (nullptr, fallback_plan)))
     {
       arabic_fallback_plan_destroy (fallback_plan);
       goto retry;
     }
   }
 
-  arabic_fallback_plan_shape (fallback_plan, font, buffer);
+  arabic_fallback_plan_shape (fallback_plan, arabic_plan->fallback_mask_array, font, buffer);
   return true;
 }
 
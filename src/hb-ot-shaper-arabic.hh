@@ -42,6 +42,11 @@ data_create_arabic (const hb_ot_shape_plan_t *plan);
 HB_INTERNAL void
 data_destroy_arabic (void *data);
 
+struct arabic_fallback_plan_t;
+
+HB_INTERNAL void
+data_destroy_arabic_fallback (arabic_fallback_plan_t *fallback_plan);
+
 HB_INTERNAL void
 setup_masks_arabic_plan (const arabic_shape_plan_t *arabic_plan,
 			 hb_buffer_t               *buffer,
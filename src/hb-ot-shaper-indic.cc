@@ -32,6 +32,7 @@
 #include "hb-ot-shaper-indic-machine.hh"
 #include "hb-ot-shaper-vowel-constraints.hh"
 #include "hb-ot-layout.hh"
+#include "hb-cache.hh"
 
 
 /*
@@ -303,6 +304,10 @@ struct indic_shape_plan_t
 #endif
   mutable hb_atomic_int_t virama_glyph;
 
+  /* consonant_position_from_face() results, keyed by consonant glyph.
+   * Filled in lazily, like virama_glyph, since they need the font. */
+  mutable hb_cache_t<16, 8, 8> consonant_position_cache;
+
   hb_indic_would_substitute_feature_t rphf;
   hb_indic_would_substitute_feature_t pref;
   hb_indic_would_substitute_feature_t blwf;
@@ -331,6 +336,7 @@ data_create_indic (const hb_ot_shape_plan_t *plan)
   indic_plan->uniscribe_bug_compatible = hb_options ().uniscribe_bug_compatible;
 #endif
   indic_plan->virama_glyph = -1;
+  indic_plan->consonant_position_cache.init ();
 
   /* Use zero-context would_substitute() matching for new-spec of the main
    * Indic scripts, and scripts with one spec only, but not for old-specs.
@@ -437,25 +443,25 @@ compare_indic_order (const hb_glyph_info_t *pa, const hb_glyph_info_t *pb)
 
 
 static void
-update_consonant_positions_indic (const hb_ot_shape_plan_t *plan,
-				  hb_font_t         *font,
-				  hb_buffer_t       *buffer)
+update_consonant_positions_indic (const indic_shape_plan_t *indic_plan,
+				  hb_codepoint_t            virama,
+				  hb_face_t                *face,
+				  hb_buffer_t              *buffer,
+				  unsigned int start, unsigned int end)
 {
-  const indic_shape_plan_t *indic_plan = (const indic_shape_plan_t *) plan->data;
-
-  hb_codepoint_t virama;
-  if (indic_plan->load_virama_glyph (font, &virama))
-  {
-    hb_face_t *face = font->face;
-    unsigned int count = buffer->len;
-    hb_glyph_info_t *info = buffer->info;
-    for (unsigned int i = 0; i < count; i++)
-      if (info[i].indic_position() == POS_BASE_C)
+  hb_glyph_info_t *info = buffer->info;
+  for (unsigned int i = start; i < end; i++)
+    if (info[i].indic_position() == POS_BASE_C)
+    {
+      hb_codepoint_t consonant = info[i].codepoint;
+      unsigned int position;
+      if (!indic_plan->consonant_position_cache.get (consonant, &position))
       {
-	hb_codepoint_t consonant = info[i].codepoint;
-	info[i].indic_position() = consonant_position_from_face (indic_plan, consonant, virama, face);
+	position = consonant_position_from_face (indic_plan, consonant, virama, face);
+	indic_plan->consonant_position_cache.set (consonant, position);
       }
-  }
+      info[i].indic_position() = position;
+    }
 }
 
 
@@ -994,7 +1000,6 @@ initial_reordering_indic (const hb_ot_shape_plan_t *plan,
   if (!buffer->message (font, "start reordering indic initial"))
     return ret;
 
-  update_consonant_positions_indic (plan, font, buffer);
   if (hb_syllabic_insert_dotted_circles (font, buffer,
 					 indic_broken_cluster,
 					 I_Cat(DOTTEDCIRCLE),
@@ -1002,8 +1007,19 @@ initial_reordering_indic (const hb_ot_shape_plan_t *plan,
 					 POS_END))
     ret = true;
 
+  /* Consonant positions are resolved per syllable, right before the
+   * syllable is reordered, instead of in a separate pass over the buffer.
+   * Dotted-circles inserted above are at POS_END and are left alone. */
+  const indic_shape_plan_t *indic_plan = (const indic_shape_plan_t *) plan->data;
+  hb_codepoint_t virama;
+  bool has_virama = indic_plan->load_virama_glyph (font, &virama);
+  hb_face_t *face = font->face;
   foreach_syllable (buffer, start, end)
-    initial_reordering_syllable_indic (plan, font->face, buffer, start, end);
+  {
+    if (has_virama)
+      update_consonant_positions_indic (indic_plan, virama, face, buffer, start, end);
+    initial_reordering_syllable_indic (plan, face, buffer, start, end);
+  }
 
   (void) buffer->message (font, "end reordering indic initial");
 
@@ -835,8 +835,8 @@ static const int use_syllable_machine_en_main = 0;
 
 #define found_syllable(syllable_type) \
   HB_STMT_START { \
-    if (0) fprintf (stderr, "syllable %u..%u %s\n", (*ts).second.first, (*te).second.first, #syllable_type); \
-    for (unsigned i = (*ts).second.first; i < (*te).second.first; ++i) \
+    if (0) fprintf (stderr, "syllable %u..%u %s\n", (*ts).second, (*te).second, #syllable_type); \
+    for (unsigned i = (*ts).second; i < (*te).second; ++i) \
       info[i].syllable() = (syllable_serial << 4) | syllable_type; \
     syllable_serial++; \
     if (syllable_serial == 16) syllable_serial = 1; \
@@ -906,19 +906,40 @@ static inline void
 find_syllables_use (hb_buffer_t *buffer)
 {
   hb_glyph_info_t *info = buffer->info;
+  unsigned int count = buffer->len;
+  if (unlikely (!count)) return;
+
+  /* The machine only sees glyphs that are not CCS default-ignorables, and
+   * ZWNJs only if no mark follows them.  Collect the indices of those
+   * glyphs into the scratch buffer up front, so that the machine steps and
+   * backtracks over them in constant time.  The list is terminated by
+   * count, which found_syllable() then uses as the end of the last
+   * syllable. */
+  unsigned int scratch_size;
+  hb_buffer_t::scratch_buffer_t *scratch = buffer->get_scratch_buffer (&scratch_size);
+  static_assert ((sizeof (scratch[0]) >= sizeof (unsigned int)), "");
+  assert (scratch_size > count);
+  unsigned int *glyphs = (unsigned int *) scratch;
+  unsigned int glyphs_len = 0;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    if (!not_ccs_default_ignorable (info[i]))
+      continue;
+    if (info[i].use_category() == USE(ZWNJ))
+    {
+      unsigned int j = i + 1;
+      while (j < count && !not_ccs_default_ignorable (info[j]))
+	j++;
+      if (j < count && _hb_glyph_info_is_unicode_mark (&info[j]))
+	continue;
+    }
+    glyphs[glyphs_len++] = i;
+  }
+  glyphs[glyphs_len] = count;
+
   auto p =
-    + hb_iter (info, buffer->len)
-    | hb_enumerate
-    | hb_filter ([] (const hb_glyph_info_t &i) { return not_ccs_default_ignorable (i); },
-		 hb_second)
-    | hb_filter ([&] (const hb_pair_t<unsigned, const hb_glyph_info_t &> p)
-		 {
-		   if (p.second.use_category() == USE(ZWNJ))
-		     for (unsigned i = p.first + 1; i < buffer->len; ++i)
-		       if (not_ccs_default_ignorable (info[i]))
-			 return !_hb_glyph_info_is_unicode_mark (&info[i]);
-		   return true;
-		 })
+    + hb_range (glyphs_len)
+    | hb_map ([glyphs] (unsigned int i) { return glyphs[i]; })
     | hb_enumerate
     | machine_index
     ;
@@ -929,7 +950,7 @@ find_syllables_use (hb_buffer_t *buffer)
   unsigned int act HB_UNUSED;
   int cs;
   
-#line 922 "hb-ot-shaper-use-machine.hh"
+#line 943 "hb-ot-shaper-use-machine.hh"
 	{
 	cs = use_syllable_machine_start;
 	ts = 0;
@@ -937,12 +958,12 @@ find_syllables_use (hb_buffer_t *buffer)
 	act = 0;
 	}
 
-#line 282 "hb-ot-shaper-use-machine.rl"
+#line 303 "hb-ot-shaper-use-machine.rl"
 
 
   unsigned int syllable_serial = 1;
   
-#line 931 "hb-ot-shaper-use-machine.hh"
+#line 952 "hb-ot-shaper-use-machine.hh"
 	{
 	int _slen;
 	int _trans;
@@ -956,16 +977,16 @@ _resume:
 #line 1 "NONE"
 	{ts = p;}
 	break;
-#line 943 "hb-ot-shaper-use-machine.hh"
+#line 964 "hb-ot-shaper-use-machine.hh"
 	}
 
 	_keys = _use_syllable_machine_trans_keys + (cs<<1);
 	_inds = _use_syllable_machine_indicies + _use_syllable_machine_index_offsets[cs];
 
 	_slen = _use_syllable_machine_key_spans[cs];
-	_trans = _inds[ _slen > 0 && _keys[0] <=( (*p).second.second.use_category()) &&
-		( (*p).second.second.use_category()) <= _keys[1] ?
-		( (*p).second.second.use_category()) - _keys[0] : _slen ];
+	_trans = _inds[ _slen > 0 && _keys[0] <=( info[(*p).second].use_category()) &&
+		( info[(*p).second].use_category()) <= _keys[1] ?
+		( info[(*p).second].use_category()) - _keys[0] : _slen ];
 
 _eof_trans:
 	cs = _use_syllable_machine_trans_targs[_trans];
@@ -1046,7 +1067,7 @@ _eof_trans:
 #line 178 "hb-ot-shaper-use-machine.rl"
 	{te = p;p--;{ found_syllable (use_non_cluster); }}
 	break;
-#line 1014 "hb-ot-shaper-use-machine.hh"
+#line 1035 "hb-ot-shaper-use-machine.hh"
 	}
 
 _again:
@@ -1055,7 +1076,7 @@ _again:
 #line 1 "NONE"
 	{ts = 0;}
 	break;
-#line 1021 "hb-ot-shaper-use-machine.hh"
+#line 1042 "hb-ot-shaper-use-machine.hh"
 	}
 
 	if ( ++p != pe )
@@ -1071,7 +1092,7 @@ _again:
 
 	}
 
-#line 287 "hb-ot-shaper-use-machine.rl"
+#line 308 "hb-ot-shaper-use-machine.rl"
 
 }
 
@@ -183,8 +183,8 @@ main := |*
 
 #define found_syllable(syllable_type) \
   HB_STMT_START { \
-    if (0) fprintf (stderr, "syllable %u..%u %s\n", (*ts).second.first, (*te).second.first, #syllable_type); \
-    for (unsigned i = (*ts).second.first; i < (*te).second.first; ++i) \
+    if (0) fprintf (stderr, "syllable %u..%u %s\n", (*ts).second, (*te).second, #syllable_type); \
+    for (unsigned i = (*ts).second; i < (*te).second; ++i) \
       info[i].syllable() = (syllable_serial << 4) | syllable_type; \
     syllable_serial++; \
     if (syllable_serial == 16) syllable_serial = 1; \
@@ -254,19 +254,40 @@ static inline void
 find_syllables_use (hb_buffer_t *buffer)
 {
   hb_glyph_info_t *info = buffer->info;
+  unsigned int count = buffer->len;
+  if (unlikely (!count)) return;
+
+  /* The machine only sees glyphs that are not CCS default-ignorables, and
+   * ZWNJs only if no mark follows them.  Collect the indices of those
+   * glyphs into the scratch buffer up front, so that the machine steps and
+   * backtracks over them in constant time.  The list is terminated by
+   * count, which found_syllable() then uses as the end of the last
+   * syllable. */
+  unsigned int scratch_size;
+  hb_buffer_t::scratch_buffer_t *scratch = buffer->get_scratch_buffer (&scratch_size);
+  static_assert ((sizeof (scratch[0]) >= sizeof (unsigned int)), "");
+  assert (scratch_size > count);
+  unsigned int *glyphs = (unsigned int *) scratch;
+  unsigned int glyphs_len = 0;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    if (!not_ccs_default_ignorable (info[i]))
+      continue;
+    if (info[i].use_category() == USE(ZWNJ))
+    {
+      unsigned int j = i + 1;
+      while (j < count && !not_ccs_default_ignorable (info[j]))
+	j++;
+      if (j < count && _hb_glyph_info_is_unicode_mark (&info[j]))
+	continue;
+    }
+    glyphs[glyphs_len++] = i;
+  }
+  glyphs[glyphs_len] = count;
+
   auto p =
-    + hb_iter (info, buffer->len)
-    | hb_enumerate
-    | hb_filter ([] (const hb_glyph_info_t &i) { return not_ccs_default_ignorable (i); },
-		 hb_second)
-    | hb_filter ([&] (const hb_pair_t<unsigned, const hb_glyph_info_t &> p)
-		 {
-		   if (p.second.use_category() == USE(ZWNJ))
-		     for (unsigned i = p.first + 1; i < buffer->len; ++i)
-		       if (not_ccs_default_ignorable (info[i]))
-			 return !_hb_glyph_info_is_unicode_mark (&info[i]);
-		   return true;
-		 })
+    + hb_range (glyphs_len)
+    | hb_map ([glyphs] (unsigned int i) { return glyphs[i]; })
     | hb_enumerate
     | machine_index
     ;
@@ -278,7 +299,7 @@ find_syllables_use (hb_buffer_t *buffer)
   int cs;
   %%{
     write init;
-    getkey (*p).second.second.use_category();
+    getkey info[(*p).second].use_category();
   }%%
 
   unsigned int syllable_serial = 1;
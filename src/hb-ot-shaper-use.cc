@@ -149,6 +149,11 @@ struct use_shape_plan_t
 {
   hb_mask_t rphf_mask;
 
+  /* Indexed by joining_form_t.  Zero if the topographical features
+   * are not set up per syllable. */
+  hb_mask_t topographical_masks[4];
+  hb_mask_t topographical_all_masks;
+
   arabic_shape_plan_t *arabic_plan;
 };
 
@@ -161,6 +166,21 @@ data_create_use (const hb_ot_shape_plan_t *plan)
 
   use_plan->rphf_mask = plan->map.get_1_mask (HB_TAG('r','p','h','f'));
 
+  /* Topographical masks are only set for scripts that don't use Arabic
+   * joining. */
+  if (!has_arabic_joining (plan->props.script))
+  {
+    static_assert ((JOINING_FORM_INIT < 4 && JOINING_FORM_ISOL < 4 && JOINING_FORM_MEDI < 4 && JOINING_FORM_FINA < 4), "");
+    for (unsigned int i = 0; i < 4; i++)
+    {
+      hb_mask_t mask = plan->map.get_1_mask (use_topographical_features[i]);
+      if (mask == plan->map.get_global_mask ())
+	mask = 0;
+      use_plan->topographical_masks[i] = mask;
+      use_plan->topographical_all_masks |= mask;
+    }
+  }
+
   if (has_arabic_joining (plan->props.script))
   {
     use_plan->arabic_plan = (arabic_shape_plan_t *) data_create_arabic (plan);
@@ -210,87 +230,66 @@ setup_masks_use (const hb_ot_shape_plan_t *plan,
 }
 
 static void
-setup_rphf_mask (const hb_ot_shape_plan_t *plan,
-		 hb_buffer_t *buffer)
+setup_rphf_mask (const use_shape_plan_t *use_plan,
+		 hb_buffer_t *buffer,
+		 unsigned int start, unsigned int end)
 {
-  const use_shape_plan_t *use_plan = (const use_shape_plan_t *) plan->data;
-
   hb_mask_t mask = use_plan->rphf_mask;
   if (!mask) return;
 
   hb_glyph_info_t *info = buffer->info;
-
-  foreach_syllable (buffer, start, end)
-  {
-    unsigned int limit = info[start].use_category() == USE(R) ? 1 : hb_min (3u, end - start);
-    for (unsigned int i = start; i < start + limit; i++)
-      info[i].mask |= mask;
-  }
+  unsigned int limit = info[start].use_category() == USE(R) ? 1 : hb_min (3u, end - start);
+  for (unsigned int i = start; i < start + limit; i++)
+    info[i].mask |= mask;
 }
 
 static void
-setup_topographical_masks (const hb_ot_shape_plan_t *plan,
-			   hb_buffer_t *buffer)
+setup_topographical_masks (const use_shape_plan_t *use_plan,
+			   hb_buffer_t *buffer,
+			   unsigned int start, unsigned int end,
+			   unsigned int *last_start,
+			   joining_form_t *last_form)
 {
-  const use_shape_plan_t *use_plan = (const use_shape_plan_t *) plan->data;
-  if (use_plan->arabic_plan)
-    return;
-
-  static_assert ((JOINING_FORM_INIT < 4 && JOINING_FORM_ISOL < 4 && JOINING_FORM_MEDI < 4 && JOINING_FORM_FINA < 4), "");
-  hb_mask_t masks[4], all_masks = 0;
-  for (unsigned int i = 0; i < 4; i++)
-  {
-    masks[i] = plan->map.get_1_mask (use_topographical_features[i]);
-    if (masks[i] == plan->map.get_global_mask ())
-      masks[i] = 0;
-    all_masks |= masks[i];
-  }
-  if (!all_masks)
-    return;
-  hb_mask_t other_masks = ~all_masks;
+  const hb_mask_t *masks = use_plan->topographical_masks;
+  hb_mask_t other_masks = ~use_plan->topographical_all_masks;
 
-  unsigned int last_start = 0;
-  joining_form_t last_form = _JOINING_FORM_NONE;
   hb_glyph_info_t *info = buffer->info;
-  foreach_syllable (buffer, start, end)
+  use_syllable_type_t syllable_type = (use_syllable_type_t) (info[start].syllable() & 0x0F);
+  switch (syllable_type)
   {
-    use_syllable_type_t syllable_type = (use_syllable_type_t) (info[start].syllable() & 0x0F);
-    switch (syllable_type)
-    {
-      case use_hieroglyph_cluster:
-      case use_non_cluster:
-	/* These don't join.  Nothing to do. */
-	last_form = _JOINING_FORM_NONE;
-	break;
+    case use_hieroglyph_cluster:
+    case use_non_cluster:
+      /* These don't join.  Nothing to do. */
+      *last_form = _JOINING_FORM_NONE;
+      break;
+
+    case use_virama_terminated_cluster:
+    case use_sakot_terminated_cluster:
+    case use_standard_cluster:
+    case use_number_joiner_terminated_cluster:
+    case use_numeral_cluster:
+    case use_symbol_cluster:
+    case use_broken_cluster:
+
+      bool join = *last_form == JOINING_FORM_FINA || *last_form == JOINING_FORM_ISOL;
+
+      if (join)
+      {
+	/* Fixup previous syllable's form. */
+	*last_form = *last_form == JOINING_FORM_FINA ? JOINING_FORM_MEDI : JOINING_FORM_INIT;
+	for (unsigned int i = *last_start; i < start; i++)
+	  info[i].mask = (info[i].mask & other_masks) | masks[*last_form];
+      }
 
-      case use_virama_terminated_cluster:
-      case use_sakot_terminated_cluster:
-      case use_standard_cluster:
-      case use_number_joiner_terminated_cluster:
-      case use_numeral_cluster:
-      case use_symbol_cluster:
-      case use_broken_cluster:
-
-	bool join = last_form == JOINING_FORM_FINA || last_form == JOINING_FORM_ISOL;
-
-	if (join)
-	{
-	  /* Fixup previous syllable's form. */
-	  last_form = last_form == JOINING_FORM_FINA ? JOINING_FORM_MEDI : JOINING_FORM_INIT;
-	  for (unsigned int i = last_start; i < start; i++)
-	    info[i].mask = (info[i].mask & other_masks) | masks[last_form];
-	}
-
-	/* Form for this syllable. */
-	last_form = join ? JOINING_FORM_FINA : JOINING_FORM_ISOL;
-	for (unsigned int i = start; i < end; i++)
-	  info[i].mask = (info[i].mask & other_masks) | masks[last_form];
+      /* Form for this syllable. */
+      *last_form = join ? JOINING_FORM_FINA : JOINING_FORM_ISOL;
+      for (unsigned int i = start; i < end; i++)
+	info[i].mask = (info[i].mask & other_masks) | masks[*last_form];
 
-	break;
-    }
-
-    last_start = start;
+      break;
   }
+
+  *last_start = start;
 }
 
 static bool
@@ -298,12 +297,22 @@ setup_syllables_use (const hb_ot_shape_plan_t *plan,
 		     hb_font_t *font HB_UNUSED,
 		     hb_buffer_t *buffer)
 {
+  const use_shape_plan_t *use_plan = (const use_shape_plan_t *) plan->data;
+
   HB_BUFFER_ALLOCATE_VAR (buffer, syllable);
   find_syllables_use (buffer);
+
+  /* Everything per-syllable is done in one walk over the syllables. */
+  bool topographical = use_plan->topographical_all_masks;
+  unsigned int last_start = 0;
+  joining_form_t last_form = _JOINING_FORM_NONE;
   foreach_syllable (buffer, start, end)
+  {
     buffer->unsafe_to_break (start, end);
-  setup_rphf_mask (plan, buffer);
-  setup_topographical_masks (plan, buffer);
+    setup_rphf_mask (use_plan, buffer, start, end);
+    if (topographical)
+      setup_topographical_masks (use_plan, buffer, start, end, &last_start, &last_form);
+  }
   return false;
 }
 
@@ -128,6 +128,8 @@ struct hb_ot_shaper_t
 
   /* compose()
    * Called during shape()'s normalization.
+   * Must only compose pairs whose b is the second character of some
+   * canonical decomposition, as the normalizer skips other marks.
    * May be NULL.
    */
   bool (*compose) (const hb_ot_shape_normalize_context_t *c,
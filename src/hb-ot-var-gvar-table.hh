@@ -101,8 +101,28 @@ struct TupleVariationHeader
   const TupleVariationHeader &get_next (unsigned axis_count) const
   { return StructAtOffset<TupleVariationHeader> (this, get_size (axis_count)); }
 
+  /* Scalar of a tuple without an intermediate region. */
+  static float calculate_peak_scalar (hb_array_t<int> coords, unsigned int coord_count,
+				      const hb_array_t<const F2DOT14> peak_tuple)
+  {
+    float scalar = 1.f;
+    for (unsigned int i = 0; i < coord_count; i++)
+    {
+      int v = coords[i];
+      int peak = peak_tuple[i].to_int ();
+      if (!peak || v == peak) continue;
+
+      if (!v || v < hb_min (0, peak) || v > hb_max (0, peak)) return 0.f;
+      scalar *= (float) v / peak;
+    }
+    return scalar;
+  }
+
+  /* shared_tuple_scalars, if not null, holds the scalars of all shared
+   * tuples at coords; see gvar::accelerator_t::cache_t. */
   float calculate_scalar (hb_array_t<int> coords, unsigned int coord_count,
-			  const hb_array_t<const F2DOT14> shared_tuples) const
+			  const hb_array_t<const F2DOT14> shared_tuples,
+			  const float *shared_tuple_scalars = nullptr) const
   {
     hb_array_t<const F2DOT14> peak_tuple;
 
@@ -113,16 +133,16 @@ struct TupleVariationHeader
       unsigned int index = get_index ();
       if (unlikely (index * coord_count >= shared_tuples.length))
 	return 0.f;
+      if (shared_tuple_scalars && !has_intermediate ())
+	return shared_tuple_scalars[index];
       peak_tuple = shared_tuples.sub_array (coord_count * index, coord_count);
     }
 
-    hb_array_t<const F2DOT14> start_tuple;
-    hb_array_t<const F2DOT14> end_tuple;
-    if (has_intermediate ())
-    {
-      start_tuple = get_start_tuple (coord_count);
-      end_tuple = get_end_tuple (coord_count);
-    }
+    if (!has_intermediate ())
+      return calculate_peak_scalar (coords, coord_count, peak_tuple);
+
+    hb_array_t<const F2DOT14> start_tuple = get_start_tuple (coord_count);
+    hb_array_t<const F2DOT14> end_tuple = get_end_tuple (coord_count);
 
     float scalar = 1.f;
     for (unsigned int i = 0; i < coord_count; i++)
@@ -131,21 +151,15 @@ struct TupleVariationHeader
       int peak = peak_tuple[i].to_int ();
       if (!peak || v == peak) continue;
 
-      if (has_intermediate ())
-      {
-	int start = start_tuple[i].to_int ();
-	int end = end_tuple[i].to_int ();
-	if (unlikely (start > peak || peak > end ||
-		      (start < 0 && end > 0 && peak))) continue;
-	if (v < start || v > end) return 0.f;
-	if (v < peak)
-	{ if (peak != start) scalar *= (float) (v - start) / (peak - start); }
-	else
-	{ if (peak != end) scalar *= (float) (end - v) / (end - peak); }
-      }
-      else if (!v || v < hb_min (0, peak) || v > hb_max (0, peak)) return 0.f;
+      int start = start_tuple[i].to_int ();
+      int end = end_tuple[i].to_int ();
+      if (unlikely (start > peak || peak > end ||
+		    (start < 0 && end > 0 && peak))) continue;
+      if (v < start || v > end) return 0.f;
+      if (v < peak)
+      { if (peak != start) scalar *= (float) (v - start) / (peak - start); }
       else
-	scalar *= (float) v / peak;
+      { if (peak != end) scalar *= (float) (end - v) / (end - peak); }
     }
     return scalar;
   }
@@ -548,9 +562,34 @@ struct gvar
     { return (i >= end) ? start : (i + 1); }
 
     public:
+    /* Scalars of the shared tuples at one set of coords, to reuse across
+     * glyphs.  Filled by fill_cache(); the owner creates a new one when the
+     * coords change. */
+    using cache_t = float;
+
+    cache_t *create_cache () const
+    {
+      unsigned count = table->sharedTupleCount;
+      if (!count) return nullptr;
+      return (cache_t *) hb_malloc (sizeof (cache_t) * count);
+    }
+
+    void fill_cache (cache_t *cache, hb_array_t<int> coords) const
+    {
+      unsigned count = table->sharedTupleCount;
+      unsigned num_coords = table->axisCount;
+      hb_array_t<const F2DOT14> shared_tuples = (table+table->sharedTuples).as_array (count * num_coords);
+      for (unsigned i = 0; i < count; i++)
+	cache[i] = TupleVariationHeader::calculate_peak_scalar (coords, num_coords,
+								shared_tuples.sub_array (i * num_coords, num_coords));
+    }
+
+    static void destroy_cache (cache_t *cache) { hb_free (cache); }
+
     bool apply_deltas_to_points (hb_codepoint_t glyph,
 				 hb_array_t<int> coords,
-				 const hb_array_t<contour_point_t> points) const
+				 const hb_array_t<contour_point_t> points,
+				 const cache_t *cache = nullptr) const
     {
       if (!coords) return true;
 
@@ -564,20 +603,26 @@ struct gvar
 						   shared_indices, &iterator))
 	return true; /* so isn't applied at all */
 
-      /* Save original points for inferred delta calculation */
-      contour_point_vector_t orig_points_vec;
-      orig_points_vec.extend (points);
-      if (unlikely (orig_points_vec.in_error ())) return false;
-      auto orig_points = orig_points_vec.as_array ();
+      /* Deltas of all tuples are summed into separate x and y arrays,
+       * starting from the original coordinates and in the same order as
+       * applying each tuple to the points would, then written back at the
+       * end.  This keeps the loops over contiguous floats, and leaves the
+       * original points in place for inferring deltas. */
+      unsigned count = points.length;
+      hb_vector_t<float> acc;
+      if (unlikely (!acc.resize (2 * count, false))) return false;
+      float *acc_x = acc.arrayZ;
+      float *acc_y = acc.arrayZ + count;
+      for (unsigned i = 0; i < count; i++)
+      {
+	acc_x[i] = points.arrayZ[i].x;
+	acc_y[i] = points.arrayZ[i].y;
+      }
 
+      /* Only needed for tuples with explicit point numbers. */
       contour_point_vector_t deltas_vec; /* flag is used to indicate referenced point */
-      if (unlikely (!deltas_vec.resize (points.length, false))) return false;
-      auto deltas = deltas_vec.as_array ();
-
       hb_vector_t<unsigned> end_points;
-      for (unsigned i = 0; i < points.length; ++i)
-	if (points.arrayZ[i].is_end_point)
-	  end_points.push (i);
+      bool end_points_found = false;
 
       unsigned num_coords = table->axisCount;
       hb_array_t<const F2DOT14> shared_tuples = (table+table->sharedTuples).as_array (table->sharedTupleCount * table->axisCount);
@@ -585,9 +630,10 @@ struct gvar
       hb_vector_t<unsigned int> private_indices;
       hb_vector_t<int> x_deltas;
       hb_vector_t<int> y_deltas;
+      bool applied = false;
       do
       {
-	float scalar = iterator.current_tuple->calculate_scalar (coords, num_coords, shared_tuples);
+	float scalar = iterator.current_tuple->calculate_scalar (coords, num_coords, shared_tuples, cache);
 	if (scalar == 0.f) continue;
 	const HBUINT8 *p = iterator.get_serialized_data ();
 	unsigned int length = iterator.current_tuple->get_data_size ();
@@ -603,19 +649,42 @@ struct gvar
 	const hb_array_t<unsigned int> &indices = has_private_points ? private_indices : shared_indices;
 
 	bool apply_to_all = (indices.length == 0);
-	unsigned int num_deltas = apply_to_all ? points.length : indices.length;
+	unsigned int num_deltas = apply_to_all ? count : indices.length;
 	if (unlikely (!x_deltas.resize (num_deltas, false))) return false;
 	if (unlikely (!GlyphVariationData::unpack_deltas (p, x_deltas, end))) return false;
 	if (unlikely (!y_deltas.resize (num_deltas, false))) return false;
 	if (unlikely (!GlyphVariationData::unpack_deltas (p, y_deltas, end))) return false;
+	applied = true;
 
+	if (apply_to_all)
+	{
+	  /* Every point is referenced; nothing to infer. */
+	  const int *xd = x_deltas.arrayZ;
+	  const int *yd = y_deltas.arrayZ;
+	  if (scalar != 1.0f)
+	    for (unsigned int i = 0; i < count; i++)
+	    {
+	      acc_x[i] += xd[i] * scalar;
+	      acc_y[i] += yd[i] * scalar;
+	    }
+	  else
+	    for (unsigned int i = 0; i < count; i++)
+	    {
+	      acc_x[i] += xd[i];
+	      acc_y[i] += yd[i];
+	    }
+	  continue;
+	}
+
+	if (unlikely (!deltas_vec.resize (count, false))) return false;
+	auto deltas = deltas_vec.as_array ();
 	hb_memset (deltas.arrayZ, 0, deltas.get_size ());
 
 	unsigned ref_points = 0;
 	if (scalar != 1.0f)
 	  for (unsigned int i = 0; i < num_deltas; i++)
 	  {
-	    unsigned int pt_index = apply_to_all ? i : indices[i];
+	    unsigned int pt_index = indices[i];
 	    if (unlikely (pt_index >= deltas.length)) continue;
 	    auto &delta = deltas.arrayZ[pt_index];
 	    ref_points += !delta.flag;
@@ -626,7 +695,7 @@ struct gvar
 	else
 	  for (unsigned int i = 0; i < num_deltas; i++)
 	  {
-	    unsigned int pt_index = apply_to_all ? i : indices[i];
+	    unsigned int pt_index = indices[i];
 	    if (unlikely (pt_index >= deltas.length)) continue;
 	    auto &delta = deltas.arrayZ[pt_index];
 	    ref_points += !delta.flag;
@@ -636,8 +705,17 @@ struct gvar
 	  }
 
 	/* infer deltas for unreferenced points */
-	if (ref_points && ref_points < orig_points.length)
+	if (ref_points && ref_points < count)
 	{
+	  if (!end_points_found)
+	  {
+	    for (unsigned i = 0; i < count; ++i)
+	      if (points.arrayZ[i].is_end_point)
+		end_points.push (i);
+	    if (unlikely (end_points.in_error ())) return false;
+	    end_points_found = true;
+	  }
+
 	  unsigned start_point = 0;
 	  for (unsigned c = 0; c < end_points.length; c++)
 	  {
@@ -679,8 +757,8 @@ struct gvar
 	      {
 		i = next_index (i, start_point, end_point);
 		if (i == next) break;
-		deltas.arrayZ[i].x = infer_delta (orig_points, deltas, i, prev, next, &contour_point_t::x);
-		deltas.arrayZ[i].y = infer_delta (orig_points, deltas, i, prev, next, &contour_point_t::y);
+		deltas.arrayZ[i].x = infer_delta (points, deltas, i, prev, next, &contour_point_t::x);
+		deltas.arrayZ[i].y = infer_delta (points, deltas, i, prev, next, &contour_point_t::y);
 		if (--unref_count == 0) goto no_more_gaps;
 	      }
 	    }
@@ -689,14 +767,21 @@ struct gvar
 	  }
 	}
 
-	/* apply specified / inferred deltas to points */
-	for (unsigned int i = 0; i < points.length; i++)
+	/* apply specified / inferred deltas */
+	for (unsigned int i = 0; i < count; i++)
 	{
-	  points.arrayZ[i].x += deltas.arrayZ[i].x;
-	  points.arrayZ[i].y += deltas.arrayZ[i].y;
+	  acc_x[i] += deltas.arrayZ[i].x;
+	  acc_y[i] += deltas.arrayZ[i].y;
 	}
       } while (iterator.move_to_next ());
 
+      if (applied)
+	for (unsigned int i = 0; i < count; i++)
+	{
+	  points.arrayZ[i].x = acc_x[i];
+	  points.arrayZ[i].y = acc_y[i];
+	}
+
       return true;
     }
 
@@ -393,11 +393,12 @@ struct VVAR : HVARVVAR {
 
   bool get_vorg_delta_unscaled (hb_codepoint_t glyph,
 				const int *coords, unsigned int coord_count,
-				float *delta) const
+				float *delta,
+				VariationStore::cache_t *store_cache = nullptr) const
   {
     if (!vorgMap) return false;
     uint32_t varidx = (this+vorgMap).map (glyph);
-    *delta = (this+varStore).get_delta (varidx, coords, coord_count);
+    *delta = (this+varStore).get_delta (varidx, coords, coord_count, store_cache);
     return true;
   }
 
@@ -73,8 +73,11 @@ struct MVAR
 				  valueRecordSize));
   }
 
+  const VariationStore &get_var_store () const { return this+varStore; }
+
   float get_var (hb_tag_t tag,
-		 const int *coords, unsigned int coord_count) const
+		 const int *coords, unsigned int coord_count,
+		 VariationStore::cache_t *store_cache = nullptr) const
   {
     const VariationValueRecord *record;
     record = (VariationValueRecord *) hb_bsearch (tag,
@@ -85,7 +88,7 @@ struct MVAR
     if (!record)
       return 0.;
 
-    return (this+varStore).get_delta (record->varIdx, coords, coord_count);
+    return (this+varStore).get_delta (record->varIdx, coords, coord_count, store_cache);
   }
 
 protected:
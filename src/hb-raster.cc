@@ -0,0 +1,1149 @@
+/*
+ * Copyright © 2026  HarfBuzz contributors
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "hb.hh"
+
+#ifndef HB_NO_RASTER
+
+#include "hb-draw.hh"
+#include "hb-map.hh"
+#include "hb-machinery.hh"
+
+#include <math.h>
+
+
+/**
+ * SECTION:hb-raster
+ * @title: hb-raster
+ * @short_description: Glyph rasterization
+ * @include: hb.h
+ *
+ * Functions for rendering glyph outlines into anti-aliased 8-bit
+ * coverage masks, without an external graphics library.
+ *
+ * A #hb_raster_t collects outlines drawn into it with the draw functions
+ * from hb_raster_get_draw_funcs(), or added from the path output of
+ * hb_font_get_glyph_path().  hb_raster_render() then computes the exact
+ * area coverage of each pixel, with the nonzero fill rule, and writes it
+ * out as an alpha mask.  Curves are flattened to within a sixteenth of a
+ * pixel first.
+ *
+ * hb_raster_render_sdf() renders the same outlines as a signed distance
+ * field instead, for GPU text rendering that scales and outlines glyphs
+ * in the shader.
+ *
+ * A #hb_raster_atlas_t uses a #hb_raster_t to render the glyphs of a font
+ * and packs them into one image, as used for glyph textures.
+ *
+ * A #hb_raster_t or #hb_raster_atlas_t must only be used from one thread
+ * at a time.  Glyphs can be rendered in parallel by giving each thread
+ * its own rasterizer; they can share the #hb_font_t.
+ **/
+
+
+/* Maximum distance of flattened curves from the real ones, in pixels. */
+#define HB_RASTER_TOLERANCE .0625f
+/* Upper bound on the number of line segments per curve. */
+#define HB_RASTER_MAX_CURVE_SEGMENTS 256
+
+struct hb_raster_line_t
+{
+  float x0, y0, x1, y1;
+};
+
+struct hb_raster_t
+{
+  hb_object_header_t header;
+
+  void clear ()
+  {
+    lines.resize (0);
+    xmin = ymin = +INFINITY;
+    xmax = ymax = -INFINITY;
+    start_x = start_y = current_x = current_y = 0.f;
+  }
+
+  /* Keeps coordinates finite and within the range that the integer
+   * extents can hold. */
+  static float sanitize (float v)
+  {
+    const float limit = 1 << 24;
+    return v > -limit ? (v < limit ? v : limit) : -limit;
+  }
+
+  void add_line (float x0, float y0, float x1, float y1)
+  {
+    /* Horizontal lines contribute no coverage, but are kept for the
+     * distances of render_sdf(). */
+    lines.push (hb_raster_line_t {x0, y0, x1, y1});
+    xmin = hb_min (xmin, hb_min (x0, x1));
+    xmax = hb_max (xmax, hb_max (x0, x1));
+    ymin = hb_min (ymin, hb_min (y0, y1));
+    ymax = hb_max (ymax, hb_max (y0, y1));
+  }
+
+  void move_to (float x, float y)
+  {
+    x = sanitize (x);
+    y = sanitize (y);
+    close_path ();
+    start_x = current_x = x;
+    start_y = current_y = y;
+  }
+
+  void line_to (float x, float y)
+  {
+    x = sanitize (x);
+    y = sanitize (y);
+    add_line (current_x, current_y, x, y);
+    current_x = x;
+    current_y = y;
+  }
+
+  static unsigned segment_count (float ddx, float ddy, float factor)
+  {
+    float dd = sqrtf (ddx * ddx + ddy * ddy);
+    float n = ceilf (sqrtf (dd * factor / HB_RASTER_TOLERANCE));
+    if (!(n >= 1.f)) return 1; /* Also catches NaN. */
+    return n < HB_RASTER_MAX_CURVE_SEGMENTS ? (unsigned) n : HB_RASTER_MAX_CURVE_SEGMENTS;
+  }
+
+  void quadratic_to (float cx, float cy, float x, float y)
+  {
+    float x0 = current_x, y0 = current_y;
+    /* The chords of n equal steps are within |p0 - 2c + p1| / (4 n^2) of the curve. */
+    unsigned n = segment_count (x0 - 2 * cx + x, y0 - 2 * cy + y, .25f);
+    float dt = 1.f / n;
+    for (unsigned i = 1; i < n; i++)
+    {
+      float t = i * dt, mt = 1 - t;
+      line_to (mt * mt * x0 + 2 * mt * t * cx + t * t * x,
+	       mt * mt * y0 + 2 * mt * t * cy + t * t * y);
+    }
+    line_to (x, y);
+  }
+
+  void cubic_to (float c1x, float c1y, float c2x, float c2y, float x, float y)
+  {
+    float x0 = current_x, y0 = current_y;
+    /* The second derivative is bounded by 6 * max |p_i - 2 p_i+1 + p_i+2|. */
+    float ddx1 = x0 - 2 * c1x + c2x, ddy1 = y0 - 2 * c1y + c2y;
+    float ddx2 = c1x - 2 * c2x + x, ddy2 = c1y - 2 * c2y + y;
+    unsigned n = hb_max (segment_count (ddx1, ddy1, .75f),
+			 segment_count (ddx2, ddy2, .75f));
+    float dt = 1.f / n;
+    for (unsigned i = 1; i < n; i++)
+    {
+      float t = i * dt, mt = 1 - t;
+      float a = mt * mt * mt, b = 3 * mt * mt * t, c = 3 * mt * t * t, d = t * t * t;
+      line_to (a * x0 + b * c1x + c * c2x + d * x,
+	       a * y0 + b * c1y + c * c2y + d * y);
+    }
+    line_to (x, y);
+  }
+
+  void close_path ()
+  {
+    if (current_x != start_x || current_y != start_y)
+      line_to (start_x, start_y);
+  }
+
+  bool get_extents (hb_glyph_extents_t *extents)
+  {
+    close_path ();
+    if (!(xmin <= xmax && ymin <= ymax))
+    {
+      *extents = hb_glyph_extents_t ();
+      return false;
+    }
+    float x0 = floorf (xmin), x1 = ceilf (xmax);
+    float y0 = floorf (ymin), y1 = ceilf (ymax);
+    extents->x_bearing = (hb_position_t) x0;
+    extents->y_bearing = (hb_position_t) y1;
+    extents->width = (hb_position_t) (x1 - x0);
+    extents->height = (hb_position_t) (y0 - y1);
+    return true;
+  }
+
+  /* Accumulates the signed area of a line, in mask coordinates with y
+   * pointing down, into the cells of the rows it crosses.  The line must
+   * go downwards and lie within [0, width] x [0, height].  The running
+   * sum of a row then is the winding-weighted coverage of each pixel;
+   * see https://medium.com/@raphlinus/inside-the-fastest-font-renderer-in-the-world-75ae5270c445 */
+  void accumulate_line (float *cells, unsigned row_length, unsigned width,
+			float x0, float y0, float x1, float y1, float dir)
+  {
+    if (!(y0 < y1))
+      return;
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    const float w = (float) width;
+    unsigned y_end = (unsigned) ceilf (y1);
+    for (unsigned y = (unsigned) y0; y < y_end; y++)
+    {
+      float *row = cells + y * row_length;
+      float dy = hb_min ((float) (y + 1), y1) - hb_max ((float) y, y0);
+      float x_next = x + dxdy * dy;
+      float d = dy * dir;
+      /* Written to map NaN to zero, so that no index goes out of range. */
+      float xa = hb_min (x, x_next), xb = hb_max (x, x_next);
+      xa = xa > 0.f ? (xa < w ? xa : w) : 0.f;
+      xb = xb > 0.f ? (xb < w ? xb : w) : 0.f;
+      float xa_floor = floorf (xa);
+      float xb_ceil = ceilf (xb);
+      unsigned xai = (unsigned) xa_floor;
+      unsigned xbi = (unsigned) xb_ceil;
+      if (xbi <= xai + 1)
+      {
+	float xm = .5f * (xa + xb) - xa_floor;
+	row[xai] += d - d * xm;
+	row[xai + 1] += d * xm;
+      }
+      else
+      {
+	float s = 1.f / (xb - xa);
+	float xaf = xa - xa_floor;
+	float a0 = .5f * s * (1 - xaf) * (1 - xaf);
+	float xbf = xb - xb_ceil + 1;
+	float am = .5f * s * xbf * xbf;
+	row[xai] += d * a0;
+	if (xbi == xai + 2)
+	  row[xai + 1] += d * (1 - a0 - am);
+	else
+	{
+	  float a1 = s * (1.5f - xaf);
+	  row[xai + 1] += d * (a1 - a0);
+	  for (unsigned xi = xai + 2; xi < xbi - 1; xi++)
+	    row[xi] += d * s;
+	  float a2 = a1 + (xbi - xai - 3) * s;
+	  row[xbi - 1] += d * (1 - a2 - am);
+	}
+	row[xbi] += d * am;
+      }
+      x = x_next;
+    }
+  }
+
+  /* Clips a downwards line to the columns [0, width]: parts to the left
+   * become vertical lines at x = 0, which cover whole rows, and parts to
+   * the right are dropped, as they cover nothing visible. */
+  void clip_line (float *cells, unsigned row_length, unsigned width,
+		  float x0, float y0, float x1, float y1, float dir)
+  {
+    const float w = (float) width;
+    if (x0 <= 0.f && x1 <= 0.f)
+    {
+      accumulate_line (cells, row_length, width, 0.f, y0, 0.f, y1, dir);
+      return;
+    }
+    if (x0 >= w && x1 >= w)
+      return;
+    for (float b : {0.f, w})
+      if ((x0 < b && x1 > b) || (x0 > b && x1 < b))
+      {
+	float yb = y0 + (b - x0) * (y1 - y0) / (x1 - x0);
+	yb = yb > y0 ? (yb < y1 ? yb : y1) : y0;
+	clip_line (cells, row_length, width, x0, y0, b, yb, dir);
+	clip_line (cells, row_length, width, b, yb, x1, y1, dir);
+	return;
+      }
+    accumulate_line (cells, row_length, width, x0, y0, x1, y1, dir);
+  }
+
+  void render (const hb_glyph_extents_t *extents, unsigned stride, uint8_t *mask)
+  {
+    close_path ();
+
+    if (extents->width <= 0 || extents->height >= 0)
+      return;
+    unsigned width = (unsigned) extents->width;
+    unsigned height = (unsigned) -extents->height;
+    unsigned row_length = width + 2;
+
+    if (unlikely (hb_unsigned_mul_overflows (row_length, height) ||
+		  !cells.resize (row_length * height)))
+    {
+      for (unsigned y = 0; y < height; y++)
+	hb_memset (mask + y * stride, 0, width);
+      return;
+    }
+    hb_memset (cells.arrayZ, 0, cells.length * sizeof (cells[0]));
+
+    const float left = extents->x_bearing;
+    const float top = extents->y_bearing;
+    const float w = (float) width, h = (float) height;
+    for (const hb_raster_line_t &l : lines)
+    {
+      if (l.y0 == l.y1)
+	continue;
+      /* To mask coordinates, with y pointing down. */
+      float x0 = l.x0 - left, y0 = top - l.y0;
+      float x1 = l.x1 - left, y1 = top - l.y1;
+      float dir = 1.f;
+      if (y0 > y1)
+      {
+	hb_swap (x0, x1);
+	hb_swap (y0, y1);
+	dir = -1.f;
+      }
+      if (y1 <= 0.f || y0 >= h || (x0 >= w && x1 >= w))
+	continue;
+      float dxdy = (x1 - x0) / (y1 - y0);
+      if (y0 < 0.f)
+      {
+	x0 += -y0 * dxdy;
+	y0 = 0.f;
+      }
+      if (y1 > h)
+      {
+	x1 = x0 + (h - y0) * dxdy;
+	y1 = h;
+      }
+      if (y0 < y1)
+	clip_line (cells.arrayZ, row_length, width, x0, y0, x1, y1, dir);
+    }
+
+    /* The running sum is inherently serial; the conversion to alpha is
+     * kept in a separate branch-free loop so that it vectorizes. */
+    for (unsigned y = 0; y < height; y++)
+    {
+      float *row = cells.arrayZ + y * row_length;
+      float sum = 0.f;
+      for (unsigned x = 0; x < width; x++)
+      {
+	sum += row[x];
+	row[x] = sum;
+      }
+      uint8_t *out = mask + y * stride;
+      for (unsigned x = 0; x < width; x++)
+      {
+	float coverage = hb_min (fabsf (row[x]), 1.f);
+	out[x] = (uint8_t) (coverage * 255.f + .5f);
+      }
+    }
+  }
+
+  void render_sdf (const hb_glyph_extents_t *extents, float spread,
+		   unsigned stride, uint8_t *sdf)
+  {
+    close_path ();
+
+    if (extents->width <= 0 || extents->height >= 0)
+      return;
+    unsigned width = (unsigned) extents->width;
+    unsigned height = (unsigned) -extents->height;
+    unsigned row_length = width + 1;
+
+    if (unlikely (hb_unsigned_mul_overflows (row_length, height) ||
+		  !cells.resize (width * height, false) ||
+		  !winding.resize (row_length * height, false)))
+    {
+      for (unsigned y = 0; y < height; y++)
+	hb_memset (sdf + y * stride, 0, width);
+      return;
+    }
+    hb_memset (winding.arrayZ, 0, winding.length * sizeof (winding[0]));
+
+    const float left = extents->x_bearing;
+    const float top = extents->y_bearing;
+    const float w = (float) width, h = (float) height;
+    const float spread2 = spread * spread;
+    for (unsigned i = 0; i < cells.length; i++)
+      cells.arrayZ[i] = spread2;
+
+    for (const hb_raster_line_t &l : lines)
+    {
+      /* To mask coordinates, with y pointing down. */
+      float x0 = l.x0 - left, y0 = top - l.y0;
+      float x1 = l.x1 - left, y1 = top - l.y1;
+
+      /* Squared distance from the pixel centers within the spread of
+       * the line to its nearest point. */
+      float dx = x1 - x0, dy = y1 - y0;
+      float len2 = dx * dx + dy * dy;
+      float inv_len2 = len2 > 0.f ? 1.f / len2 : 0.f;
+      float px0 = hb_max (ceilf (hb_min (x0, x1) - spread - .5f), 0.f);
+      float px1 = hb_min (floorf (hb_max (x0, x1) + spread - .5f), w - 1);
+      float py0 = hb_max (ceilf (hb_min (y0, y1) - spread - .5f), 0.f);
+      float py1 = hb_min (floorf (hb_max (y0, y1) + spread - .5f), h - 1);
+      if (px0 <= px1)
+	for (unsigned py = (unsigned) py0; py <= py1; py++)
+	{
+	  float *row = cells.arrayZ + py * width;
+	  float cy = py + .5f - y0;
+	  for (unsigned px = (unsigned) px0; px <= px1; px++)
+	  {
+	    float cx = px + .5f - x0;
+	    float t = (cx * dx + cy * dy) * inv_len2;
+	    t = t > 0.f ? (t < 1.f ? t : 1.f) : 0.f;
+	    float ex = t * dx - cx, ey = t * dy - cy;
+	    row[px] = hb_min (row[px], ex * ex + ey * ey);
+	  }
+	}
+
+      /* Winding changes where the line crosses the centers of a row. */
+      if (y0 == y1)
+	continue;
+      int dir = 1;
+      if (y0 > y1)
+      {
+	hb_swap (x0, x1);
+	hb_swap (y0, y1);
+	dir = -1;
+      }
+      float r0 = hb_max (ceilf (y0 - .5f), 0.f);
+      float r1 = hb_min (ceilf (y1 - .5f), h);
+      float dxdy = (x1 - x0) / (y1 - y0);
+      for (unsigned r = (unsigned) r0; r < r1; r++)
+      {
+	float x = x0 + (r + .5f - y0) * dxdy;
+	float i = ceilf (x - .5f);
+	i = i > 0.f ? (i < w ? i : w) : 0.f;
+	winding.arrayZ[r * row_length + (unsigned) i] += dir;
+      }
+    }
+
+    const float scale = 127.5f / spread;
+    for (unsigned y = 0; y < height; y++)
+    {
+      const float *row = cells.arrayZ + y * width;
+      const int *crossings = winding.arrayZ + y * row_length;
+      uint8_t *out = sdf + y * stride;
+      int inside = 0;
+      for (unsigned x = 0; x < width; x++)
+      {
+	inside += crossings[x];
+	float d = sqrtf (row[x]) * scale;
+	float v = 127.5f + (inside ? d : -d);
+	v = v > 0.f ? (v < 255.f ? v : 255.f) : 0.f;
+	out[x] = (uint8_t) (v + .5f);
+      }
+    }
+  }
+
+  hb_vector_t<hb_raster_line_t> lines;
+  float xmin, ymin, xmax, ymax;
+  float start_x, start_y;
+  float current_x, current_y;
+  hb_vector_t<float> cells;
+  hb_vector_t<int> winding;
+};
+
+struct hb_raster_atlas_t
+{
+  hb_object_header_t header;
+
+  hb_raster_t *raster;
+  unsigned width;
+  unsigned height;
+  hb_vector_t<uint8_t> data;
+  /* Shelf packing: glyphs are placed left to right on the current shelf,
+   * and a new shelf is started below it when a glyph does not fit. */
+  unsigned shelf_x;
+  unsigned shelf_y;
+  unsigned shelf_height;
+  hb_hashmap_t<hb_codepoint_t, unsigned> glyphs;
+  hb_vector_t<hb_raster_atlas_entry_t> entries;
+};
+
+
+/**
+ * hb_raster_create:
+ *
+ * Creates a new, empty rasterizer.
+ *
+ * Return value: (transfer full): The new #hb_raster_t
+ *
+ * Since: REPLACEME
+ **/
+hb_raster_t *
+hb_raster_create ()
+{
+  hb_raster_t *raster;
+
+  if (!(raster = hb_object_create<hb_raster_t> ()))
+    return hb_raster_get_empty ();
+
+  raster->clear ();
+
+  return raster;
+}
+
+/**
+ * hb_raster_get_empty:
+ *
+ * Fetches the singleton empty #hb_raster_t.  Drawing into it has no
+ * effect, and it renders empty masks.
+ *
+ * Return value: (transfer full): The empty #hb_raster_t
+ *
+ * Since: REPLACEME
+ **/
+hb_raster_t *
+hb_raster_get_empty ()
+{
+  return const_cast<hb_raster_t *> (&Null (hb_raster_t));
+}
+
+/**
+ * hb_raster_reference: (skip)
+ * @raster: A rasterizer
+ *
+ * Increases the reference count on a rasterizer.
+ *
+ * Return value: (transfer full): The rasterizer
+ *
+ * Since: REPLACEME
+ **/
+hb_raster_t *
+hb_raster_reference (hb_raster_t *raster)
+{
+  return hb_object_reference (raster);
+}
+
+/**
+ * hb_raster_destroy: (skip)
+ * @raster: A rasterizer
+ *
+ * Decreases the reference count on a rasterizer. When
+ * the reference count reaches zero, the rasterizer is
+ * destroyed, freeing all memory.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_destroy (hb_raster_t *raster)
+{
+  if (!hb_object_destroy (raster)) return;
+
+  hb_free (raster);
+}
+
+/**
+ * hb_raster_set_user_data: (skip)
+ * @raster: A rasterizer
+ * @key: The user-data key to set
+ * @data: A pointer to the user data to set
+ * @destroy: (nullable): A callback to call when @data is not needed anymore
+ * @replace: Whether to replace an existing data with the same key
+ *
+ * Attaches a user-data key/data pair to the specified rasterizer.
+ *
+ * Return value: `true` if success, `false` otherwise
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_raster_set_user_data (hb_raster_t        *raster,
+			 hb_user_data_key_t *key,
+			 void *              data,
+			 hb_destroy_func_t   destroy,
+			 hb_bool_t           replace)
+{
+  return hb_object_set_user_data (raster, key, data, destroy, replace);
+}
+
+/**
+ * hb_raster_get_user_data: (skip)
+ * @raster: A rasterizer
+ * @key: The user-data key to query
+ *
+ * Fetches the user data associated with the specified key,
+ * attached to the specified rasterizer.
+ *
+ * Return value: (transfer none): A pointer to the user data
+ *
+ * Since: REPLACEME
+ **/
+void *
+hb_raster_get_user_data (const hb_raster_t  *raster,
+			 hb_user_data_key_t *key)
+{
+  return hb_object_get_user_data (raster, key);
+}
+
+
+static void
+hb_raster_move_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+		   void *draw_data,
+		   hb_draw_state_t *st HB_UNUSED,
+		   float to_x, float to_y,
+		   void *user_data HB_UNUSED)
+{
+  hb_raster_t *raster = (hb_raster_t *) draw_data;
+  if (unlikely (hb_object_is_immutable (raster))) return;
+  raster->move_to (to_x, to_y);
+}
+
+static void
+hb_raster_line_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+		   void *draw_data,
+		   hb_draw_state_t *st HB_UNUSED,
+		   float to_x, float to_y,
+		   void *user_data HB_UNUSED)
+{
+  hb_raster_t *raster = (hb_raster_t *) draw_data;
+  if (unlikely (hb_object_is_immutable (raster))) return;
+  raster->line_to (to_x, to_y);
+}
+
+static void
+hb_raster_quadratic_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+			void *draw_data,
+			hb_draw_state_t *st HB_UNUSED,
+			float control_x, float control_y,
+			float to_x, float to_y,
+			void *user_data HB_UNUSED)
+{
+  hb_raster_t *raster = (hb_raster_t *) draw_data;
+  if (unlikely (hb_object_is_immutable (raster))) return;
+  raster->quadratic_to (control_x, control_y, to_x, to_y);
+}
+
+static void
+hb_raster_cubic_to (hb_draw_funcs_t *dfuncs HB_UNUSED,
+		    void *draw_data,
+		    hb_draw_state_t *st HB_UNUSED,
+		    float control1_x, float control1_y,
+		    float control2_x, float control2_y,
+		    float to_x, float to_y,
+		    void *user_data HB_UNUSED)
+{
+  hb_raster_t *raster = (hb_raster_t *) draw_data;
+  if (unlikely (hb_object_is_immutable (raster))) return;
+  raster->cubic_to (control1_x, control1_y, control2_x, control2_y, to_x, to_y);
+}
+
+static void
+hb_raster_close_path (hb_draw_funcs_t *dfuncs HB_UNUSED,
+		      void *draw_data,
+		      hb_draw_state_t *st HB_UNUSED,
+		      void *user_data HB_UNUSED)
+{
+  hb_raster_t *raster = (hb_raster_t *) draw_data;
+  if (unlikely (hb_object_is_immutable (raster))) return;
+  raster->close_path ();
+}
+
+static inline void free_static_raster_draw_funcs ();
+
+static struct hb_raster_draw_funcs_lazy_loader_t : hb_draw_funcs_lazy_loader_t<hb_raster_draw_funcs_lazy_loader_t>
+{
+  static hb_draw_funcs_t *create ()
+  {
+    hb_draw_funcs_t *funcs = hb_draw_funcs_create ();
+
+    hb_draw_funcs_set_move_to_func (funcs, hb_raster_move_to, nullptr, nullptr);
+    hb_draw_funcs_set_line_to_func (funcs, hb_raster_line_to, nullptr, nullptr);
+    hb_draw_funcs_set_quadratic_to_func (funcs, hb_raster_quadratic_to, nullptr, nullptr);
+    hb_draw_funcs_set_cubic_to_func (funcs, hb_raster_cubic_to, nullptr, nullptr);
+    hb_draw_funcs_set_close_path_func (funcs, hb_raster_close_path, nullptr, nullptr);
+
+    hb_draw_funcs_make_immutable (funcs);
+
+    hb_atexit (free_static_raster_draw_funcs);
+
+    return funcs;
+  }
+} static_raster_draw_funcs;
+
+static inline
+void free_static_raster_draw_funcs ()
+{
+  static_raster_draw_funcs.free_instance ();
+}
+
+/**
+ * hb_raster_get_draw_funcs:
+ *
+ * Fetches the draw functions that add outlines to a #hb_raster_t.  Pass
+ * them to hb_font_draw_glyph() with the rasterizer as the draw data.
+ *
+ * Return value: (transfer none): The rasterizer draw functions
+ *
+ * Since: REPLACEME
+ **/
+hb_draw_funcs_t *
+hb_raster_get_draw_funcs ()
+{
+  return static_raster_draw_funcs.get_unconst ();
+}
+
+/**
+ * hb_raster_clear:
+ * @raster: A rasterizer
+ *
+ * Removes all outlines from @raster.  The memory used by @raster is kept
+ * for reuse.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_clear (hb_raster_t *raster)
+{
+  if (unlikely (hb_object_is_immutable (raster)))
+    return;
+
+  raster->clear ();
+}
+
+/**
+ * hb_raster_add_path:
+ * @raster: A rasterizer
+ * @verbs: (array length=verbs_length): The path verbs, as #hb_draw_verb_t values
+ * @verbs_length: The number of verbs
+ * @coords: (array length=coords_length): The x,y coordinates of the path points
+ * @coords_length: The number of coordinates, twice the number of points
+ *
+ * Adds a path, as returned by hb_font_get_glyph_path(), to @raster.
+ * Adding stops at the first verb that lacks coordinates.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_add_path (hb_raster_t   *raster,
+		    const uint8_t *verbs,
+		    unsigned int   verbs_length,
+		    const float   *coords,
+		    unsigned int   coords_length)
+{
+  if (unlikely (hb_object_is_immutable (raster)))
+    return;
+
+  const float *p = coords;
+  const float *end = coords + coords_length;
+  for (unsigned i = 0; i < verbs_length; i++)
+    switch (verbs[i])
+    {
+    case HB_DRAW_VERB_MOVE_TO:
+      if (unlikely (end - p < 2)) return;
+      raster->move_to (p[0], p[1]);
+      p += 2;
+      break;
+    case HB_DRAW_VERB_LINE_TO:
+      if (unlikely (end - p < 2)) return;
+      raster->line_to (p[0], p[1]);
+      p += 2;
+      break;
+    case HB_DRAW_VERB_QUADRATIC_TO:
+      if (unlikely (end - p < 4)) return;
+      raster->quadratic_to (p[0], p[1], p[2], p[3]);
+      p += 4;
+      break;
+    case HB_DRAW_VERB_CUBIC_TO:
+      if (unlikely (end - p < 6)) return;
+      raster->cubic_to (p[0], p[1], p[2], p[3], p[4], p[5]);
+      p += 6;
+      break;
+    case HB_DRAW_VERB_CLOSE_PATH:
+      raster->close_path ();
+      break;
+    default:
+      return;
+    }
+}
+
+/**
+ * hb_raster_get_extents:
+ * @raster: A rasterizer
+ * @extents: (out): The pixel extents of the outlines in @raster
+ *
+ * Fetches the smallest whole-pixel box that covers the outlines in
+ * @raster, in the same convention as #hb_glyph_extents_t: the top-left
+ * corner is at @extents.x_bearing, @extents.y_bearing, and
+ * @extents.height is negative.  A mask of @extents.width by
+ * -@extents.height pixels rendered with these extents holds the whole
+ * outline.
+ *
+ * Return value: `true` if @raster has outlines, `false` otherwise, in
+ * which case @extents is set to zero
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_raster_get_extents (hb_raster_t        *raster,
+		       hb_glyph_extents_t *extents /* OUT */)
+{
+  if (unlikely (hb_object_is_immutable (raster)))
+  {
+    *extents = hb_glyph_extents_t ();
+    return false;
+  }
+
+  return raster->get_extents (extents);
+}
+
+/**
+ * hb_raster_render:
+ * @raster: A rasterizer
+ * @extents: (nullable): The pixel box to render, as returned by
+ *   hb_raster_get_extents(), or `NULL` to use the extents of @raster
+ * @stride: The distance between the starts of two rows of @mask, in bytes
+ * @mask: (out caller-allocates): The mask to render into, with at least
+ *   -@extents.height rows of @stride bytes
+ *
+ * Renders the outlines in @raster into @mask as 8-bit coverage values,
+ * with 0 for pixels outside the outlines and 255 for pixels fully inside.
+ * Row 0 of @mask is the top row of the box given by @extents, and the
+ * parts of the outlines outside the box are clipped away.  Outlines use
+ * the nonzero fill rule; any contour that is not closed is closed first.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_render (hb_raster_t              *raster,
+		  const hb_glyph_extents_t *extents,
+		  unsigned int              stride,
+		  uint8_t                  *mask /* OUT */)
+{
+  hb_glyph_extents_t raster_extents;
+  if (!extents)
+  {
+    hb_raster_get_extents (raster, &raster_extents);
+    extents = &raster_extents;
+  }
+
+  if (unlikely (hb_object_is_immutable (raster)))
+  {
+    if (extents->width > 0)
+      for (int y = 0; y < -extents->height; y++)
+	hb_memset (mask + y * stride, 0, extents->width);
+    return;
+  }
+
+  raster->render (extents, stride, mask);
+}
+
+/**
+ * hb_raster_render_sdf:
+ * @raster: A rasterizer
+ * @extents: (nullable): The pixel box to render, or `NULL` to use the
+ *   extents of @raster grown by @spread on every side
+ * @spread: The distance from the outline, in pixels, at which values
+ *   saturate
+ * @stride: The distance between the starts of two rows of @sdf, in bytes
+ * @sdf: (out caller-allocates): The image to render into, with at least
+ *   -@extents.height rows of @stride bytes
+ *
+ * Renders the outlines in @raster into @sdf as a signed distance field:
+ * each pixel holds the distance from its center to the nearest point of
+ * the outlines, mapped from [-@spread, @spread] to [0, 255], so that the
+ * outline itself is at 128 and values grow inwards.  Insideness uses the
+ * nonzero fill rule, like hb_raster_render().
+ *
+ * The extents that `NULL` stands for can be computed with
+ * hb_raster_get_extents(), moving each edge out by @spread rounded up.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_render_sdf (hb_raster_t              *raster,
+		      const hb_glyph_extents_t *extents,
+		      float                     spread,
+		      unsigned int              stride,
+		      uint8_t                  *sdf /* OUT */)
+{
+  /* Bounds the work per line and keeps the pixel ranges finite. */
+  if (!(spread >= HB_RASTER_TOLERANCE)) spread = HB_RASTER_TOLERANCE;
+  if (spread > 1 << 16) spread = 1 << 16;
+
+  hb_glyph_extents_t raster_extents;
+  if (!extents)
+  {
+    if (hb_raster_get_extents (raster, &raster_extents))
+    {
+      hb_position_t pad = (hb_position_t) ceilf (spread);
+      raster_extents.x_bearing -= pad;
+      raster_extents.y_bearing += pad;
+      raster_extents.width += 2 * pad;
+      raster_extents.height -= 2 * pad;
+    }
+    extents = &raster_extents;
+  }
+
+  if (unlikely (hb_object_is_immutable (raster)))
+  {
+    if (extents->width > 0)
+      for (int y = 0; y < -extents->height; y++)
+	hb_memset (sdf + y * stride, 0, extents->width);
+    return;
+  }
+
+  raster->render_sdf (extents, spread, stride, sdf);
+}
+
+
+/**
+ * hb_raster_atlas_create:
+ * @width: The width of the atlas image, in pixels
+ * @height: The height of the atlas image, in pixels
+ *
+ * Creates a new, empty glyph atlas with an image of @width by @height
+ * pixels, one byte each.
+ *
+ * Return value: (transfer full): The new #hb_raster_atlas_t
+ *
+ * Since: REPLACEME
+ **/
+hb_raster_atlas_t *
+hb_raster_atlas_create (unsigned int width,
+			unsigned int height)
+{
+  hb_raster_atlas_t *atlas;
+
+  if (unlikely (!width || !height ||
+		hb_unsigned_mul_overflows (width, height)))
+    return hb_raster_atlas_get_empty ();
+
+  if (!(atlas = hb_object_create<hb_raster_atlas_t> ()))
+    return hb_raster_atlas_get_empty ();
+
+  atlas->raster = hb_raster_create ();
+  if (unlikely (hb_object_is_immutable (atlas->raster) ||
+		!atlas->data.resize (width * height)))
+  {
+    hb_raster_atlas_destroy (atlas);
+    return hb_raster_atlas_get_empty ();
+  }
+  atlas->width = width;
+  atlas->height = height;
+
+  return atlas;
+}
+
+/**
+ * hb_raster_atlas_get_empty:
+ *
+ * Fetches the singleton empty #hb_raster_atlas_t, which has a zero-sized
+ * image and no room for glyphs.
+ *
+ * Return value: (transfer full): The empty #hb_raster_atlas_t
+ *
+ * Since: REPLACEME
+ **/
+hb_raster_atlas_t *
+hb_raster_atlas_get_empty ()
+{
+  return const_cast<hb_raster_atlas_t *> (&Null (hb_raster_atlas_t));
+}
+
+/**
+ * hb_raster_atlas_reference: (skip)
+ * @atlas: A glyph atlas
+ *
+ * Increases the reference count on a glyph atlas.
+ *
+ * Return value: (transfer full): The glyph atlas
+ *
+ * Since: REPLACEME
+ **/
+hb_raster_atlas_t *
+hb_raster_atlas_reference (hb_raster_atlas_t *atlas)
+{
+  return hb_object_reference (atlas);
+}
+
+/**
+ * hb_raster_atlas_destroy: (skip)
+ * @atlas: A glyph atlas
+ *
+ * Decreases the reference count on a glyph atlas. When
+ * the reference count reaches zero, the glyph atlas is
+ * destroyed, freeing all memory.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_atlas_destroy (hb_raster_atlas_t *atlas)
+{
+  if (!hb_object_destroy (atlas)) return;
+
+  hb_raster_destroy (atlas->raster);
+
+  hb_free (atlas);
+}
+
+/**
+ * hb_raster_atlas_set_user_data: (skip)
+ * @atlas: A glyph atlas
+ * @key: The user-data key to set
+ * @data: A pointer to the user data to set
+ * @destroy: (nullable): A callback to call when @data is not needed anymore
+ * @replace: Whether to replace an existing data with the same key
+ *
+ * Attaches a user-data key/data pair to the specified glyph atlas.
+ *
+ * Return value: `true` if success, `false` otherwise
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_raster_atlas_set_user_data (hb_raster_atlas_t  *atlas,
+			       hb_user_data_key_t *key,
+			       void *              data,
+			       hb_destroy_func_t   destroy,
+			       hb_bool_t           replace)
+{
+  return hb_object_set_user_data (atlas, key, data, destroy, replace);
+}
+
+/**
+ * hb_raster_atlas_get_user_data: (skip)
+ * @atlas: A glyph atlas
+ * @key: The user-data key to query
+ *
+ * Fetches the user data associated with the specified key,
+ * attached to the specified glyph atlas.
+ *
+ * Return value: (transfer none): A pointer to the user data
+ *
+ * Since: REPLACEME
+ **/
+void *
+hb_raster_atlas_get_user_data (const hb_raster_atlas_t *atlas,
+			       hb_user_data_key_t      *key)
+{
+  return hb_object_get_user_data (atlas, key);
+}
+
+/**
+ * hb_raster_atlas_add_glyph:
+ * @atlas: A glyph atlas
+ * @font: The font to draw @glyph with
+ * @glyph: The glyph to add
+ * @entry: (out): The placement of @glyph in @atlas
+ *
+ * Renders @glyph of @font into the image of @atlas, if it is not there
+ * yet, and fetches its placement.  Glyphs are looked up by glyph index
+ * only, so all glyphs added to an atlas must come from the same font at
+ * the same scale and variation settings; call hb_raster_atlas_clear()
+ * before adding glyphs of another.  Glyphs with an empty outline take no
+ * room and get zero extents.  Masks are separated by one pixel of blank
+ * space, so that they can be sampled with bilinear filtering.
+ *
+ * Return value: `true` if @glyph is in @atlas, `false` if there is not
+ * enough room left for it
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_raster_atlas_add_glyph (hb_raster_atlas_t       *atlas,
+			   hb_font_t               *font,
+			   hb_codepoint_t           glyph,
+			   hb_raster_atlas_entry_t *entry /* OUT */)
+{
+  *entry = hb_raster_atlas_entry_t ();
+  if (unlikely (hb_object_is_immutable (atlas)))
+    return false;
+
+  unsigned *index;
+  if (atlas->glyphs.has (glyph, &index))
+  {
+    *entry = atlas->entries[*index];
+    return true;
+  }
+
+  hb_raster_t *raster = atlas->raster;
+  raster->clear ();
+  hb_font_draw_glyph (font, glyph, hb_raster_get_draw_funcs (), raster);
+
+  hb_raster_atlas_entry_t e = hb_raster_atlas_entry_t ();
+  if (raster->get_extents (&e.extents))
+  {
+    unsigned w = (unsigned) e.extents.width;
+    unsigned h = (unsigned) -e.extents.height;
+    if (w > atlas->width || h > atlas->height)
+      return false;
+    if (atlas->shelf_x + w > atlas->width)
+    {
+      atlas->shelf_y += atlas->shelf_height + 1;
+      atlas->shelf_x = 0;
+      atlas->shelf_height = 0;
+    }
+    if (atlas->shelf_y > atlas->height || h > atlas->height - atlas->shelf_y)
+      return false;
+
+    e.x = atlas->shelf_x;
+    e.y = atlas->shelf_y;
+    raster->render (&e.extents, atlas->width,
+		    atlas->data.arrayZ + e.y * atlas->width + e.x);
+
+    atlas->shelf_x += w + 1;
+    atlas->shelf_height = hb_max (atlas->shelf_height, h);
+  }
+
+  atlas->entries.push (e);
+  if (likely (!atlas->entries.in_error ()))
+    atlas->glyphs.set (glyph, atlas->entries.length - 1);
+
+  *entry = e;
+  return true;
+}
+
+/**
+ * hb_raster_atlas_get_data:
+ * @atlas: A glyph atlas
+ * @width: (out) (optional): The width of the atlas image, in pixels
+ * @height: (out) (optional): The height of the atlas image, in pixels
+ *
+ * Fetches the image of @atlas: @height rows of @width coverage bytes
+ * each, with no padding between rows.  The image stays valid until
+ * @atlas is destroyed, and changes as glyphs are added.
+ *
+ * Return value: (transfer none): The atlas image
+ *
+ * Since: REPLACEME
+ **/
+const uint8_t *
+hb_raster_atlas_get_data (hb_raster_atlas_t *atlas,
+			  unsigned int      *width,  /* OUT */
+			  unsigned int      *height  /* OUT */)
+{
+  if (width) *width = atlas->width;
+  if (height) *height = atlas->height;
+  return atlas->data.arrayZ;
+}
+
+/**
+ * hb_raster_atlas_clear:
+ * @atlas: A glyph atlas
+ *
+ * Removes all glyphs from @atlas and blanks its image.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_raster_atlas_clear (hb_raster_atlas_t *atlas)
+{
+  if (unlikely (hb_object_is_immutable (atlas)))
+    return;
+
+  hb_memset (atlas->data.arrayZ, 0, atlas->data.length);
+  atlas->shelf_x = atlas->shelf_y = atlas->shelf_height = 0;
+  atlas->glyphs.clear ();
+  atlas->entries.resize (0);
+}
+
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * Copyright © 2026  HarfBuzz contributors
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#if !defined(HB_H_IN) && !defined(HB_NO_SINGLE_HEADER_ERROR)
+#error "Include <hb.h> instead."
+#endif
+
+#ifndef HB_RASTER_H
+#define HB_RASTER_H
+
+#include "hb-common.h"
+#include "hb-draw.h"
+#include "hb-font.h"
+
+HB_BEGIN_DECLS
+
+/**
+ * hb_raster_t:
+ *
+ * Data type for rasterizing glyph outlines into 8-bit coverage masks.
+ *
+ * Outlines are added by drawing into the raster with the draw functions
+ * returned by hb_raster_get_draw_funcs(), or from the flat path output
+ * of hb_font_get_glyph_path(), and then rendered with
+ * hb_raster_render().  Coordinates are taken to be in pixels, so the
+ * scale of the font being drawn sets the pixel size of the glyphs.
+ *
+ * Since: REPLACEME
+ **/
+typedef struct hb_raster_t hb_raster_t;
+
+HB_EXTERN hb_raster_t *
+hb_raster_create (void);
+
+HB_EXTERN hb_raster_t *
+hb_raster_get_empty (void);
+
+HB_EXTERN hb_raster_t *
+hb_raster_reference (hb_raster_t *raster);
+
+HB_EXTERN void
+hb_raster_destroy (hb_raster_t *raster);
+
+HB_EXTERN hb_bool_t
+hb_raster_set_user_data (hb_raster_t        *raster,
+			 hb_user_data_key_t *key,
+			 void *              data,
+			 hb_destroy_func_t   destroy,
+			 hb_bool_t           replace);
+
+HB_EXTERN void *
+hb_raster_get_user_data (const hb_raster_t  *raster,
+			 hb_user_data_key_t *key);
+
+HB_EXTERN hb_draw_funcs_t *
+hb_raster_get_draw_funcs (void);
+
+HB_EXTERN void
+hb_raster_clear (hb_raster_t *raster);
+
+HB_EXTERN void
+hb_raster_add_path (hb_raster_t   *raster,
+		    const uint8_t *verbs,
+		    unsigned int   verbs_length,
+		    const float   *coords,
+		    unsigned int   coords_length);
+
+HB_EXTERN hb_bool_t
+hb_raster_get_extents (hb_raster_t        *raster,
+		       hb_glyph_extents_t *extents /* OUT */);
+
+HB_EXTERN void
+hb_raster_render (hb_raster_t              *raster,
+		  const hb_glyph_extents_t *extents,
+		  unsigned int              stride,
+		  uint8_t                  *mask /* OUT */);
+
+HB_EXTERN void
+hb_raster_render_sdf (hb_raster_t              *raster,
+		      const hb_glyph_extents_t *extents,
+		      float                     spread,
+		      unsigned int              stride,
+		      uint8_t                  *sdf /* OUT */);
+
+
+/**
+ * hb_raster_atlas_t:
+ *
+ * Data type for packing the coverage masks of the glyphs of one font into
+ * a single 8-bit image, for use as a glyph texture.
+ *
+ * Since: REPLACEME
+ **/
+typedef struct hb_raster_atlas_t hb_raster_atlas_t;
+
+/**
+ * hb_raster_atlas_entry_t:
+ * @x: left edge of the glyph mask in the atlas image, in pixels
+ * @y: top edge of the glyph mask in the atlas image, in pixels
+ * @extents: the pixel extents of the glyph mask; the mask is
+ *   @extents.width pixels wide and -@extents.height pixels high, and its
+ *   top-left pixel is at @extents.x_bearing, @extents.y_bearing from the
+ *   glyph origin
+ *
+ * The placement of a glyph mask in a #hb_raster_atlas_t.
+ *
+ * Since: REPLACEME
+ **/
+typedef struct hb_raster_atlas_entry_t {
+  unsigned int x;
+  unsigned int y;
+  hb_glyph_extents_t extents;
+} hb_raster_atlas_entry_t;
+
+HB_EXTERN hb_raster_atlas_t *
+hb_raster_atlas_create (unsigned int width,
+			unsigned int height);
+
+HB_EXTERN hb_raster_atlas_t *
+hb_raster_atlas_get_empty (void);
+
+HB_EXTERN hb_raster_atlas_t *
+hb_raster_atlas_reference (hb_raster_atlas_t *atlas);
+
+HB_EXTERN void
+hb_raster_atlas_destroy (hb_raster_atlas_t *atlas);
+
+HB_EXTERN hb_bool_t
+hb_raster_atlas_set_user_data (hb_raster_atlas_t  *atlas,
+			       hb_user_data_key_t *key,
+			       void *              data,
+			       hb_destroy_func_t   destroy,
+			       hb_bool_t           replace);
+
+HB_EXTERN void *
+hb_raster_atlas_get_user_data (const hb_raster_atlas_t *atlas,
+			       hb_user_data_key_t      *key);
+
+HB_EXTERN hb_bool_t
+hb_raster_atlas_add_glyph (hb_raster_atlas_t       *atlas,
+			   hb_font_t               *font,
+			   hb_codepoint_t           glyph,
+			   hb_raster_atlas_entry_t *entry /* OUT */);
+
+HB_EXTERN const uint8_t *
+hb_raster_atlas_get_data (hb_raster_atlas_t *atlas,
+			  unsigned int      *width,  /* OUT */
+			  unsigned int      *height  /* OUT */);
+
+HB_EXTERN void
+hb_raster_atlas_clear (hb_raster_atlas_t *atlas);
+
+HB_END_DECLS
+
+#endif /* HB_RASTER_H */
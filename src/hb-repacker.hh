@@ -36,6 +36,11 @@
 
 using graph::graph_t;
 
+#ifdef HB_REPACKER_DUMP_GRAPHS
+HB_INTERNAL void
+hb_repacker_dump_graph (hb_tag_t table_tag, const graph_t& graph);
+#endif
+
 /*
  * For a detailed writeup on the overflow resolution algorithm see:
  * docs/repacker.md
@@ -311,6 +316,10 @@ hb_resolve_graph_overflows (hb_tag_t table_tag,
         DEBUG_MSG (SUBSET_REPACK, nullptr, "Extensions promotion failed.");
         return false;
       }
+
+      // Splitting and promotion edit links directly, so the incremental
+      // distance tracking can't be relied on past this point.
+      sorted_graph.invalidate_distances ();
     }
 
     DEBUG_MSG (SUBSET_REPACK, nullptr, "Assigning spaces to 32 bit subgraphs.");
@@ -328,6 +337,7 @@ hb_resolve_graph_overflows (hb_tag_t table_tag,
          && round < max_rounds) {
     DEBUG_MSG (SUBSET_REPACK, nullptr, "=== Overflow resolution round %u ===", round);
     print_overflows (sorted_graph, overflows);
+    sorted_graph.stats.resolution_rounds++;
 
     hb_set_t priority_bumped_parents;
 
@@ -346,6 +356,15 @@ hb_resolve_graph_overflows (hb_tag_t table_tag,
     sorted_graph.sort_shortest_distance ();
   }
 
+  DEBUG_MSG (SUBSET_REPACK, nullptr,
+             "Resolution done after %u rounds: %u sorts, %u full and %u incremental"
+             " distance updates (%u vertices updated incrementally).",
+             sorted_graph.stats.resolution_rounds,
+             sorted_graph.stats.sorts,
+             sorted_graph.stats.full_distance_updates,
+             sorted_graph.stats.incremental_distance_updates,
+             sorted_graph.stats.distance_updated_vertices);
+
   if (sorted_graph.in_error ())
   {
     DEBUG_MSG (SUBSET_REPACK, nullptr, "Sorted graph in error state.");
@@ -401,6 +420,10 @@ hb_resolve_overflows (const T& packed,
     return nullptr;
   }
 
+#ifdef HB_REPACKER_DUMP_GRAPHS
+  hb_repacker_dump_graph (table_tag, sorted_graph);
+#endif
+
   if (!hb_resolve_graph_overflows (table_tag, max_rounds, recalculate_extensions, sorted_graph))
     return nullptr;
 
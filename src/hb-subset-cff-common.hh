@@ -226,51 +226,6 @@ struct flatten_param_t
   const hb_subset_plan_t *plan;
 };
 
-template <typename ACC, typename ENV, typename OPSET, op_code_t endchar_op=OpCode_Invalid>
-struct subr_flattener_t
-{
-  subr_flattener_t (const ACC &acc_,
-		    const hb_subset_plan_t *plan_)
-		   : acc (acc_), plan (plan_) {}
-
-  bool flatten (str_buff_vec_t &flat_charstrings)
-  {
-    unsigned count = plan->num_output_glyphs ();
-    if (!flat_charstrings.resize_exact (count))
-      return false;
-    for (unsigned int i = 0; i < count; i++)
-    {
-      hb_codepoint_t  glyph;
-      if (!plan->old_gid_for_new_gid (i, &glyph))
-      {
-	/* add an endchar only charstring for a missing glyph if CFF1 */
-	if (endchar_op != OpCode_Invalid) flat_charstrings[i].push (endchar_op);
-	continue;
-      }
-      const hb_ubytes_t str = (*acc.charStrings)[glyph];
-      unsigned int fd = acc.fdSelect->get_fd (glyph);
-      if (unlikely (fd >= acc.fdCount))
-	return false;
-
-
-      ENV env (str, acc, fd,
-	       plan->normalized_coords.arrayZ, plan->normalized_coords.length);
-      cs_interpreter_t<ENV, OPSET, flatten_param_t> interp (env);
-      flatten_param_t  param = {
-        flat_charstrings.arrayZ[i],
-        (bool) (plan->flags & HB_SUBSET_FLAGS_NO_HINTING),
-	plan
-      };
-      if (unlikely (!interp.interpret (param)))
-	return false;
-    }
-    return true;
-  }
-
-  const ACC &acc;
-  const hb_subset_plan_t *plan;
-};
-
 struct subr_closures_t
 {
   subr_closures_t (unsigned int fd_count) : global_closure (), local_closures ()
@@ -458,6 +413,69 @@ struct cff_subset_accelerator_t
     hb_map_destroy (glyph_to_sid_map.get_relaxed ());
   }
 
+  /* Copies the cached flattened charstrings of the plan's glyphs into
+   * flat_charstrings. The new gids that were found are added to cached. */
+  bool get_flattened_charstrings (const hb_subset_plan_t *plan,
+				  bool drop_hints,
+				  str_buff_vec_t &flat_charstrings, /* IN/OUT */
+				  hb_set_t &cached /* OUT */) const
+  {
+    hb_lock_t lock (flattened_lock);
+    const hb_set_t &glyphs = flattened_glyphs[drop_hints];
+    if (glyphs.is_empty ()) return true;
+
+    const str_buff_vec_t &cache = flattened_charstrings[drop_hints];
+    for (unsigned i = 0; i < flat_charstrings.length; i++)
+    {
+      hb_codepoint_t glyph;
+      if (!plan->old_gid_for_new_gid (i, &glyph) || !glyphs.has (glyph))
+	continue;
+
+      flat_charstrings.arrayZ[i] = cache.arrayZ[glyph];
+      if (unlikely (flat_charstrings.arrayZ[i].in_error ()))
+	return false;
+      cached.add (i);
+    }
+    return !cached.in_error ();
+  }
+
+  /* Adds the flattened charstrings not found by get_flattened_charstrings ()
+   * to the cache, as long as it stays within HB_CFF_MAX_FLATTENED_CACHE_SIZE
+   * bytes. */
+  void add_flattened_charstrings (const hb_subset_plan_t *plan,
+				  bool drop_hints,
+				  const str_buff_vec_t &flat_charstrings,
+				  const hb_set_t &cached) const
+  {
+    hb_lock_t lock (flattened_lock);
+    hb_set_t &glyphs = flattened_glyphs[drop_hints];
+    str_buff_vec_t &cache = flattened_charstrings[drop_hints];
+    if (unlikely (!cache.resize (parsed_charstrings.length))) return;
+
+    for (unsigned i = 0; i < flat_charstrings.length; i++)
+    {
+      hb_codepoint_t glyph;
+      if (cached.has (i) ||
+	  !plan->old_gid_for_new_gid (i, &glyph) ||
+	  glyph >= cache.length ||
+	  glyphs.has (glyph))
+	continue;
+
+      unsigned size = flat_charstrings.arrayZ[i].length;
+      if (flattened_size + size > HB_CFF_MAX_FLATTENED_CACHE_SIZE)
+	return;
+
+      cache.arrayZ[glyph] = flat_charstrings.arrayZ[i];
+      if (unlikely (cache.arrayZ[glyph].in_error ()))
+      {
+	cache.arrayZ[glyph].fini ();
+	return;
+      }
+      glyphs.add (glyph);
+      flattened_size += size;
+    }
+  }
+
   parsed_cs_str_vec_t parsed_charstrings;
   parsed_cs_str_vec_t parsed_global_subrs;
   hb_vector_t<parsed_cs_str_vec_t> parsed_local_subrs;
@@ -465,8 +483,80 @@ struct cff_subset_accelerator_t
 
  private:
   hb_blob_t* original_blob;
+
+  /* Desubroutinized charstrings, indexed by [drop_hints][glyph]. Filled in
+   * by the subset requests that desubroutinize without instancing. */
+  mutable hb_mutex_t flattened_lock;
+  mutable str_buff_vec_t flattened_charstrings[2];
+  mutable hb_set_t flattened_glyphs[2];
+  mutable unsigned flattened_size = 0;
 };
 
+template <typename ACC, typename ENV, typename OPSET, op_code_t endchar_op=OpCode_Invalid>
+struct subr_flattener_t
+{
+  subr_flattener_t (const ACC &acc_,
+		    const hb_subset_plan_t *plan_)
+		   : acc (acc_), plan (plan_) {}
+
+  bool flatten (str_buff_vec_t &flat_charstrings)
+  {
+    unsigned count = plan->num_output_glyphs ();
+    if (!flat_charstrings.resize_exact (count))
+      return false;
+
+    /* Without instancing, flattened charstrings only depend on the hinting
+     * flag, so they are shared with other requests through the accelerator. */
+    bool drop_hints = plan->flags & HB_SUBSET_FLAGS_NO_HINTING;
+    const cff_subset_accelerator_t *cff_accelerator = nullptr;
+    if (plan->accelerator && plan->accelerator->cff_accelerator &&
+	!plan->normalized_coords)
+      cff_accelerator = plan->accelerator->cff_accelerator;
+
+    hb_set_t cached;
+    if (cff_accelerator &&
+	unlikely (!cff_accelerator->get_flattened_charstrings (plan, drop_hints, flat_charstrings, cached)))
+      return false;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+      hb_codepoint_t  glyph;
+      if (!plan->old_gid_for_new_gid (i, &glyph))
+      {
+	/* add an endchar only charstring for a missing glyph if CFF1 */
+	if (endchar_op != OpCode_Invalid) flat_charstrings[i].push (endchar_op);
+	continue;
+      }
+      if (cached.has (i))
+	continue;
+      const hb_ubytes_t str = (*acc.charStrings)[glyph];
+      unsigned int fd = acc.fdSelect->get_fd (glyph);
+      if (unlikely (fd >= acc.fdCount))
+	return false;
+
+
+      ENV env (str, acc, fd,
+	       plan->normalized_coords.arrayZ, plan->normalized_coords.length);
+      cs_interpreter_t<ENV, OPSET, flatten_param_t> interp (env);
+      flatten_param_t  param = {
+        flat_charstrings.arrayZ[i],
+        (bool) (plan->flags & HB_SUBSET_FLAGS_NO_HINTING),
+	plan
+      };
+      if (unlikely (!interp.interpret (param)))
+	return false;
+    }
+
+    if (cff_accelerator)
+      cff_accelerator->add_flattened_charstrings (plan, drop_hints, flat_charstrings, cached);
+    return true;
+  }
+
+  const ACC &acc;
+  const hb_subset_plan_t *plan;
+};
+
+
 struct subr_subset_param_t
 {
   subr_subset_param_t (parsed_cs_str_t *parsed_charstring_,
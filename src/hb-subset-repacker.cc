@@ -24,6 +24,39 @@
  */
 #include "hb-repacker.hh"
 
+#ifdef HB_REPACKER_DUMP_GRAPHS
+/*
+ * Debug hook which records every graph handed to the repacker, before any
+ * modifications, so that it can be replayed by perf/benchmark-repacker or
+ * used as a fuzzer seed. Graphs are written to the directory named by the
+ * HB_REPACKER_DUMP_DIR environment variable (default: current directory) as
+ * repacker-<table tag>-<n>.graph.
+ */
+void
+hb_repacker_dump_graph (hb_tag_t table_tag, const graph_t& graph)
+{
+  static hb_atomic_int_t counter;
+  unsigned n = counter.inc ();
+
+  const char *dir = getenv ("HB_REPACKER_DUMP_DIR");
+  char path[1024];
+  snprintf (path, sizeof (path), "%s/repacker-%c%c%c%c-%u.graph",
+	    dir ? dir : ".", HB_UNTAG (table_tag), n);
+
+  FILE *f = fopen (path, "wb");
+  if (unlikely (!f)) return;
+
+  bool ret = graph.save_fuzzer_seed (table_tag, f);
+  fclose (f);
+
+  if (unlikely (!ret))
+  {
+    DEBUG_MSG (SUBSET_REPACK, nullptr, "Graph is too large to be dumped to %s.", path);
+    remove (path);
+  }
+}
+#endif
+
 #ifdef HB_EXPERIMENTAL_API
 
 /**
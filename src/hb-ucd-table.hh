@@ -1065,6 +1065,21 @@ _hb_ucd_dm2_u64_map[388] =
    HB_CODEPOINT_ENCODE3 (0x1D1BBu, 0x1D16Eu, 0x0000u), HB_CODEPOINT_ENCODE3 (0x1D1BBu, 0x1D16Fu, 0x0000u),
    HB_CODEPOINT_ENCODE3 (0x1D1BCu, 0x1D16Eu, 0x0000u), HB_CODEPOINT_ENCODE3 (0x1D1BCu, 0x1D16Fu, 0x0000u),
 };
+static const uint32_t
+_hb_ucd_cq_map[85] =
+{
+    0x0300u,  0x0301u,  0x0302u,  0x0303u,  0x0304u,  0x0306u,  0x0307u,  0x0308u,
+    0x0309u,  0x030Au,  0x030Bu,  0x030Cu,  0x030Fu,  0x0311u,  0x0313u,  0x0314u,
+    0x031Bu,  0x0323u,  0x0324u,  0x0325u,  0x0326u,  0x0327u,  0x0328u,  0x032Du,
+    0x032Eu,  0x0330u,  0x0331u,  0x0338u,  0x0342u,  0x0345u,  0x05B4u,  0x05B7u,
+    0x05B8u,  0x05B9u,  0x05BCu,  0x05BFu,  0x05C1u,  0x05C2u,  0x0653u,  0x0654u,
+    0x0655u,  0x093Cu,  0x09BCu,  0x09BEu,  0x09D7u,  0x0A3Cu,  0x0B3Cu,  0x0B3Eu,
+    0x0B56u,  0x0B57u,  0x0BBEu,  0x0BD7u,  0x0C56u,  0x0CC2u,  0x0CD5u,  0x0CD6u,
+    0x0D3Eu,  0x0D57u,  0x0DCAu,  0x0DCFu,  0x0DDFu,  0x0F72u,  0x0F74u,  0x0F80u,
+    0x0FB5u,  0x0FB7u,  0x102Eu,  0x1B35u,  0x3099u,  0x309Au, 0x110BAu, 0x11127u,
+   0x1133Eu, 0x11357u, 0x114B0u, 0x114BAu, 0x114BDu, 0x115AFu, 0x11930u, 0x1D165u,
+   0x1D16Eu, 0x1D16Fu, 0x1D170u, 0x1D171u, 0x1D172u,
+};
 
 #ifndef HB_OPTIMIZE_SIZE
 
@@ -2826,6 +2841,1076 @@ _hb_ucd_dm (unsigned u)
 }
 
 
+static const uint8_t
+_hb_ucd_props_page[2176] =
+{
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+   16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   28, 26, 29, 30, 31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 34, 34,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39,
+   40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+   26, 56, 57, 58, 58, 58, 58, 59, 26, 26, 60, 58, 58, 58, 58, 58,
+   58, 58, 26, 61, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 26, 62, 58, 63, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 64, 26, 26, 65, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 66, 67, 68, 58, 58, 58, 58, 69, 58,
+   58, 58, 58, 58, 58, 58, 58, 70, 71, 72, 73, 74, 75, 76, 58, 77,
+   78, 79, 80, 81, 82, 58, 83, 84, 85, 86, 75, 87, 88, 89, 58, 58,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 90, 26, 26, 26, 26, 26, 26, 26, 91, 92, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 93, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 94, 58, 58, 58, 58, 58, 58, 26, 95, 58, 58,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 96, 26, 26, 26, 26, 26, 26,
+   26, 97, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   98, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 99,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 99,
+};
+static const uint16_t
+_hb_ucd_props_u16[3200] =
+{
+     0,   0,   1,   2,   3,   4,   5,   6,   0,   0,   7,   8,   9,  10,  11,  12,
+    13,  13,  13,  14,  15,  13,  13,  16,  17,  18,  19,  20,  21,  22,  13,  23,
+    13,  13,  13,  24,  25,  11,  11,  11,  11,  26,  11,  27,  28,  29,  30,  31,
+    32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  11,  43,  44,  13,  45,
+     9,   9,   9,  11,  11,  11,  13,  13,  46,  13,  13,  13,  47,  13,  13,  13,
+    13,  13,  13,  48,   9,  49,  11,  11,  50,  51,  52,  53,  54,  55,  56,  57,
+    58,  59,  55,  55,  60,  61,  62,  63,  55,  55,  55,  55,  55,  64,  65,  66,
+    67,  68,  55,  69,  70,  55,  55,  55,  55,  55,  71,  72,  73,  55,  74,  75,
+    55,  76,  77,  78,  55,  79,  80,  55,  81,  82,  55,  55,  83,  84,  85,  86,
+    87,  55,  55,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100,
+   101,  94,  95, 102, 103, 104, 105, 106, 107, 108,  95, 109, 110, 111,  99, 112,
+   113,  94,  95, 114, 115, 116,  99, 117, 118, 119, 120, 121, 122, 123, 105, 124,
+   125, 126,  95, 127, 128, 129,  99, 130, 131, 126,  95, 132, 133, 134,  99, 135,
+   136, 126,  55, 137, 138, 139,  99, 140, 141, 142,  55, 143, 144, 145, 105, 146,
+   147,  55,  55, 148, 149, 150, 151, 151, 152,  55, 153, 154, 155, 156, 151, 151,
+   157, 158, 159, 160, 161,  55, 162, 163, 164, 165, 166, 167, 168, 169, 151, 151,
+    55,  55, 170, 171, 172, 173, 174, 175, 176, 177,   9,   9, 178,  11,  11, 179,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55, 180, 181,  55,  55, 180,  55,  55, 182, 183, 184,  55,  55,
+    55, 183,  55,  55,  55, 185, 186, 187,  55, 188,   9,   9,   9,   9,   9, 189,
+   190,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55, 191,  55, 192, 193,  55,  55,  55,  55, 194, 195,
+    55, 196,  55, 197,  55, 198, 199, 200,  55,  55,  55, 201, 202, 203, 204, 205,
+   206, 204,  55,  55, 207,  55,  55, 208, 209,  55, 210,  55,  55,  55,  55, 211,
+    55, 212, 213, 214, 215,  55, 216, 217,  55,  55, 218,  55, 219, 220, 221, 221,
+    55, 222,  55,  55,  55, 223, 224, 225, 204, 204, 226, 227, 228, 151, 151, 151,
+   229,  55,  55, 230, 231, 172, 232, 233, 234,  55, 235,  73,  55,  55, 236, 237,
+    55,  55, 238, 239, 240,  73,  55, 241, 242,   9,   9, 243, 244, 245, 246, 247,
+    11,  11, 248,  27,  27,  27, 249, 250,  11, 251,  27,  27, 252, 253,  32, 254,
+    13,  13,  13,  13,  13,  13,  13,  13,  13, 255,  13,  13,  13,  13,  13,  13,
+   256, 257, 256, 256, 257, 258, 256, 259, 260, 260, 260, 261, 262, 263, 264, 265,
+   266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 276, 277, 278, 279, 280,
+   281, 282, 283, 284, 285, 286, 287, 287, 288, 289, 290, 221, 291, 292, 221, 293,
+   294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+   295, 221, 296, 221, 221, 221, 221, 297, 221, 298, 294, 299, 221, 300, 301, 221,
+   221, 221, 302, 151, 303, 151, 286, 286, 286, 304, 221, 221, 221, 221, 305, 286,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 306, 307, 221, 221, 308,
+   221, 221, 221, 221, 221, 221, 309, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+   221, 221, 221, 221, 221, 221, 310, 311, 286, 312, 221, 221, 313, 294, 314, 294,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+   294, 294, 294, 294, 294, 294, 294, 294, 315, 316, 294, 294, 294, 317, 294, 318,
+   294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+   221, 221, 221, 294, 319, 221, 221, 320, 221, 321, 221, 221, 221, 221, 221, 221,
+     9,   9,   9,  11,  11,  11, 322, 323,  13,  13,  13,  13,  13,  13, 324, 325,
+    11,  11, 326,  55,  55,  55, 327, 328,  55, 329, 330, 330, 330, 330,  32,  32,
+   331, 332, 333, 334, 335, 336, 151, 151, 221, 337, 221, 221, 221, 221, 221, 338,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 339, 151, 340,
+   341, 342, 343, 344, 147,  55,  55,  55,  55, 345, 190,  55,  55,  55,  55, 346,
+   347,  55,  55, 147,  55,  55,  55,  55, 212, 348,  55,  55, 221, 221, 338,  55,
+   221, 349, 350, 221, 351, 352, 221, 221, 350, 221, 221, 352, 221, 221, 221, 221,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 221, 221, 221, 221,
+    55, 353,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55, 162, 221, 221, 221, 302,  55,  55, 241,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+   354,  55, 355, 151,  13,  13, 356, 357,  13, 358,  55,  55,  55,  55, 359, 360,
+    31, 361, 362, 363,  13,  13,  13, 364, 365, 366, 367, 368, 369, 370, 151, 371,
+   372,  55, 373, 374,  55,  55,  55, 375, 376,  55,  55, 377, 378, 204,  32, 379,
+    73,  55, 380,  55, 381, 382,  55, 162,  87,  55,  55, 383, 384, 385, 386, 387,
+    55,  55, 388, 389, 390, 391,  55, 392,  55,  55,  55, 393, 394, 395, 396, 397,
+   398, 399, 330,  11,  11, 400, 401,  11,  11,  11,  11,  11,  55,  55, 402, 204,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 403,  55, 404,  55,  55, 218,
+   405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405,
+   405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405,
+   406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+   406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+   406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55, 216,  55,  55,  55,  55,  55,  55, 219, 151, 151,
+   407, 408, 409, 410, 411,  55,  55,  55,  55,  55,  55, 412, 413, 414,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55, 415, 221,  55,  55,  55,  55, 416,  55,  55, 417, 151, 151, 418,
+   166, 419, 420, 421, 422, 423, 424, 425,  55,  55,  55,  55,  55,  55,  55, 426,
+   427,   2,   3,   4,   5, 428, 429, 430,  55, 431,  55, 212, 432, 433, 434, 435,
+   436,  55, 184, 437, 216, 216, 151, 151,  55,  55,  55,  55,  55,  55,  55,  80,
+   438, 286, 286, 439, 287, 287, 287, 440, 441, 442, 443, 151, 151, 221, 221, 444,
+   151, 151, 151, 151, 151, 151, 151, 151,  55, 162,  55,  55,  55, 111, 445, 446,
+    55,  55, 447,  55, 448,  55,  55, 449,  55, 450,  55,  55, 451, 452, 151, 151,
+     9,   9, 453,  11,  11,  55,  55,  55,  55, 216, 204,   9,   9, 454,  11, 455,
+    55,  55, 456,  55,  55,  55, 457, 458, 458, 459, 460, 461, 151, 151, 151, 151,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55, 329,  55, 211, 456, 151, 462,  27,  27, 463, 151, 151, 151, 151,
+   464,  55,  55, 465,  55, 466,  55, 467,  55, 212, 468, 151, 151, 151,  55, 469,
+    55, 470,  55, 471, 151, 151, 151, 151,  55,  55,  55, 472, 286, 473, 286, 286,
+   474, 475,  55, 476, 477, 478,  55, 479,  55, 480, 151, 151, 481,  55, 482, 483,
+    55,  55,  55, 484,  55, 485,  55, 486,  55, 487, 488, 151, 151, 151, 151, 151,
+    55,  55,  55,  55, 208, 151, 151, 151,   9,   9,   9, 489,  11,  11,  11, 490,
+    55,  55, 491, 204, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 286, 492,  55,  55, 493, 494, 151, 151, 151, 495,
+    55, 480, 496,  55, 497, 498, 151,  55, 499, 151, 151,  55, 500, 151,  55, 329,
+   501,  55,  55, 502, 503, 473, 504, 505, 234,  55,  55, 506, 507,  55, 208, 204,
+   508,  55, 509, 510, 511,  55,  55, 512, 234,  55,  55, 513, 514, 515, 516, 517,
+    55, 108, 518, 519, 520, 151, 151, 151, 521, 522, 523,  55,  55, 524, 525, 204,
+   526,  94,  95, 527, 528, 529, 530, 531, 151, 151, 151, 151, 151, 151, 151, 151,
+    55,  55,  55, 532, 533, 534, 494, 151,  55,  55,  55, 535, 536, 204, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151,  55,  55, 537, 538, 539, 540, 151, 151,
+    55,  55,  55, 541, 542, 204, 543, 151,  55,  55, 544, 545, 204, 151, 151, 151,
+    55, 546, 547, 548, 329, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    55,  55, 518, 549, 151, 151, 151, 151, 151, 151,   9,   9,  11,  11, 159, 550,
+   551, 552,  55, 553, 554, 204, 151, 151, 151, 151, 555,  55,  55, 556, 557, 151,
+   558,  55,  55, 559, 560, 561,  55,  55, 562, 563, 564,  55,  55,  55,  55, 208,
+   565, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    95,  55, 537, 566, 567, 159, 187, 568,  55, 569, 570, 571, 151, 151, 151, 151,
+   572,  55,  55, 573, 574, 204, 575,  55, 576, 577, 204, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,  55, 578,
+   579, 126,  55, 580, 581, 204, 151, 151, 151, 151, 151, 111, 286, 582, 583, 584,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55, 219, 151, 151, 151, 151, 151, 151,
+   287, 287, 287, 287, 287, 287, 585, 586,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55, 403, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151,  55,  55,  55,  55,  55,  55, 587,
+    55,  55,  55, 588, 589, 590, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    55,  55,  55,  55, 329, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    55,  55,  55, 208,  55, 212, 385,  55,  55,  55,  55, 212, 204,  55, 216, 591,
+    55,  55,  55, 592, 593, 594, 595, 596,  55, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151,   9,   9,  11,  11, 286, 597, 151, 151, 151, 151, 151, 151,
+    55,  55,  55,  55, 598, 599, 600, 600, 601, 602, 151, 151, 151, 151, 603, 604,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 456,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 211, 151, 151,
+   208, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 605,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55, 606, 607, 151, 608, 609,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 218,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    55,  55,  55,  55,  55,  55,  80, 162, 208, 610, 611, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   166, 166, 612, 166, 613, 221, 221, 221, 221, 221, 221, 221, 338, 151, 151, 151,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 339,
+   221, 221, 614, 221, 221, 221, 615, 616, 617, 221, 618, 221, 221, 221, 303, 151,
+   221, 221, 221, 221, 619, 151, 151, 151, 151, 151, 151, 151, 286, 620, 286, 620,
+   221, 221, 221, 221, 221, 302, 286, 477, 151, 151, 151, 151, 151, 151, 151, 151,
+     9, 621,  11, 622, 623, 624, 256,   9, 625, 626, 627, 628, 629,   9, 621,  11,
+   630, 631,  11, 632, 633, 634, 635,   9, 636,  11,   9, 621,  11, 622, 623,  11,
+   256,   9, 625, 635,   9, 636,  11,   9, 621,  11, 637,   9, 638, 639, 640, 641,
+    11, 642,   9, 643, 644, 645, 646,  11, 647,   9, 648,  11, 649, 650, 650, 650,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+   166, 166, 166, 651, 166, 166, 652, 653, 654, 655, 656, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   657, 658, 659, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   660, 661, 662,  27,  27,  27, 663, 151, 664, 151, 151, 151, 151, 151, 151, 151,
+    55,  55, 162, 665, 666, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151,  55, 667, 151,  55,  55, 668, 669,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,  55, 670, 204,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 671, 212,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 672, 673, 151, 151,
+     9,   9, 625,  11, 674, 385, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 516, 286, 286, 675, 676, 151, 151, 151, 151,
+   516, 286, 677, 678, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   679,  55, 680, 681, 682, 683, 684, 685, 686, 218, 687, 218, 151, 151, 151, 688,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   221, 221, 340, 221, 221, 221, 221, 221, 221, 338, 349, 689, 689, 689, 221, 339,
+   690, 221, 221, 221, 221, 221, 221, 221, 221, 221, 691, 151, 151, 151, 692, 221,
+   693, 221, 221, 340, 694, 695, 339, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 696,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 697, 442, 442,
+   221, 221, 221, 221, 221, 221, 221, 698, 221, 221, 221, 221, 221, 188, 340, 443,
+   340, 221, 221, 221, 699, 188, 221, 221, 699, 221, 691, 695, 151, 151, 151, 151,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+   221, 221, 221, 221, 221, 338, 691, 442, 694, 221, 221, 700, 701, 340, 694, 694,
+   221, 221, 221, 221, 221, 221, 221, 221, 221, 702, 221, 221, 303, 151, 151, 204,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 151, 151,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55, 219,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55, 216,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 494,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 111, 151,
+    55, 216, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  80,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    55,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55, 151, 151, 151, 151, 151,
+   703, 151, 588, 588, 588, 588, 588, 588, 151, 151, 151, 151, 151, 151, 151, 151,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 151,
+   406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+   406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 704,
+};
+static const uint8_t
+_hb_ucd_props_u8[11280] =
+{
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1,  2,  2,  2,  3,  2,  2,  2,  4,  5,  2,  6,  2,  7,  2,  2,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  2,  2,  6,  6,  6,  2,
+    2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  4,  2,  5, 10, 11,
+   10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  4,  6,  5,  6,  0,
+    1,  2,  3,  3,  3,  3, 13,  2, 10, 13, 14, 15,  6, 16, 13, 10,
+   13,  6, 17, 17, 10, 12,  2,  2, 10, 17, 14, 18, 17, 17, 17,  2,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9,  9,  6,  9,  9,  9,  9,  9,  9,  9, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12,  6, 12, 12, 12, 12, 12, 12, 12, 12,
+    9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+    9, 12,  9, 12,  9, 12,  9, 12, 12,  9, 12,  9, 12,  9, 12,  9,
+   12,  9, 12,  9, 12,  9, 12,  9, 12, 12,  9, 12,  9, 12,  9, 12,
+    9, 12,  9, 12,  9, 12,  9, 12,  9,  9, 12,  9, 12,  9, 12, 12,
+   12,  9,  9, 12,  9, 12,  9,  9, 12,  9,  9,  9, 12, 12,  9,  9,
+    9,  9, 12,  9,  9, 12,  9,  9,  9, 12, 12, 12,  9,  9, 12,  9,
+    9, 12,  9, 12,  9, 12,  9,  9, 12,  9, 12, 12,  9, 12,  9,  9,
+   12,  9,  9,  9, 12,  9, 12,  9,  9, 12, 12, 14,  9, 12, 12, 12,
+   14, 14, 14, 14,  9, 19, 12,  9, 19, 12,  9, 19, 12,  9, 12,  9,
+   12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12, 12,  9, 12,
+   12,  9, 19, 12,  9, 12,  9,  9,  9, 12,  9, 12,  9, 12,  9, 12,
+    9, 12,  9, 12, 12, 12, 12, 12, 12, 12,  9,  9, 12,  9,  9, 12,
+   12,  9, 12,  9,  9,  9,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+   12, 12, 12, 12, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   20, 20, 10, 10, 10, 10, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   20, 20, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   20, 20, 20, 20, 20, 10, 10, 10, 10, 10, 10, 10, 20, 10, 20, 10,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 22, 23, 23, 23, 23, 22, 24, 23, 23, 23, 23,
+   23, 25, 25, 23, 23, 23, 23, 25, 25, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 26, 26, 26, 26, 26, 23, 23, 23, 23, 21, 21, 21,
+   21, 21, 21, 21, 21, 27, 21, 23, 23, 23, 21, 21, 21, 23, 23, 28,
+   21, 21, 21, 23, 23, 23, 23, 21, 22, 23, 23, 21, 29, 30, 30, 29,
+   30, 30, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    9, 12,  9, 12, 20, 10,  9, 12, 31, 31, 20, 12, 12, 12,  2,  9,
+   31, 31, 31, 31, 10, 10,  9,  2,  9,  9,  9, 31,  9, 31,  9,  9,
+   12,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9, 31,  9,  9,  9,  9,  9,  9,  9,  9,  9, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  9,
+   12, 12,  9,  9,  9, 12, 12, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+   12, 12, 12, 12,  9, 12,  6,  9, 12,  9,  9, 12, 12,  9,  9,  9,
+    9, 12, 13, 21, 21, 21, 21, 21, 32, 32,  9, 12,  9, 12,  9, 12,
+    9,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12, 12,
+   31,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9,  9, 31, 31, 20,  2,  2,  2,  2,  2,  2,
+   12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  7, 31, 31, 13, 13,  3,
+   31, 23, 21, 21, 21, 21, 23, 21, 21, 21, 33, 23, 21, 21, 21, 21,
+   21, 21, 23, 23, 23, 23, 23, 23, 21, 21, 23, 21, 21, 33, 34, 21,
+   35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 44, 45, 46, 47,  7, 48,
+    2, 49, 50,  2, 21, 23,  2, 43, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 14,
+   14, 14, 14,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   16, 16, 16, 16, 16, 16,  6,  6,  6,  2,  2,  3,  2,  2, 13, 13,
+   21, 21, 21, 21, 21, 21, 21, 21, 51, 52, 53,  2, 16,  2,  2,  2,
+   20, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 54, 55, 56, 51, 52,
+   53, 57, 58, 21, 21, 23, 23, 21, 21, 21, 21, 21, 23, 21, 21, 23,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  2,  2,  2,  2, 14, 14,
+   59, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14,  2, 14, 21, 21, 21, 21, 21, 21, 21, 16, 13, 21,
+   21, 21, 21, 23, 21, 20, 20, 21, 21, 13, 23, 21, 21, 23, 14, 14,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 14, 14, 14, 13, 13, 14,
+    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 31, 16,
+   14, 60, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   21, 23, 21, 21, 23, 21, 21, 23, 23, 23, 21, 23, 23, 21, 23, 21,
+   21, 21, 23, 21, 23, 21, 23, 21, 23, 21, 21, 31, 31, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 21, 21, 21, 21, 21,
+   21, 21, 23, 21, 20, 20, 13,  2,  2,  2, 20, 31, 31, 23,  3,  3,
+   14, 14, 14, 14, 14, 14, 21, 21, 21, 21, 20, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 20, 21, 21, 21, 20, 21, 21, 21, 21, 21, 31, 31,
+    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 23, 23, 23, 31, 31,  2, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 10, 14, 14, 14, 14, 14, 14, 31,
+   16, 16, 31, 31, 31, 31, 31, 31, 21, 23, 23, 23, 21, 21, 21, 21,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 20, 21, 21, 21, 21, 21, 23,
+   23, 23, 23, 23, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 16, 23, 21, 21, 23, 21, 21, 23, 21, 21, 21, 23, 23, 23,
+   54, 55, 56, 21, 21, 21, 23, 21, 21, 23, 23, 21, 21, 21, 21, 21,
+   28, 28, 28, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 61, 62, 14, 61, 61,
+   61, 28, 28, 28, 28, 28, 28, 28, 28, 61, 61, 61, 61, 63, 61, 61,
+   14, 21, 23, 21, 21, 28, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 28, 28,  2,  2,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    2, 20, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 28, 61, 61, 31, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 14,
+   14, 31, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14,
+   14, 31, 14, 31, 31, 31, 14, 14, 14, 14, 31, 31, 62, 14, 61, 61,
+   61, 28, 28, 28, 28, 31, 31, 61, 61, 31, 31, 61, 61, 63, 14, 31,
+   31, 31, 31, 31, 31, 31, 31, 61, 31, 31, 31, 31, 14, 14, 31, 14,
+   14, 14, 28, 28, 31, 31,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   14, 14,  3,  3, 17, 17, 17, 17, 17, 17, 13,  3, 14,  2, 21, 31,
+   31, 28, 28, 61, 31, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 14,
+   14, 31, 14, 14, 31, 14, 14, 31, 14, 14, 31, 31, 62, 31, 61, 61,
+   61, 28, 28, 31, 31, 31, 31, 28, 28, 31, 31, 28, 28, 63, 31, 31,
+   31, 28, 31, 31, 31, 31, 31, 31, 31, 14, 14, 14, 14, 31, 14, 31,
+   31, 31, 31, 31, 31, 31,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   28, 28, 14, 14, 14, 28,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 28, 28, 61, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14,
+   14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 31, 14, 14, 31, 14, 14, 14, 14, 14, 31, 31, 62, 14, 61, 61,
+   61, 28, 28, 28, 28, 28, 31, 28, 28, 61, 31, 61, 61, 63, 31, 31,
+   14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    2,  3, 31, 31, 31, 31, 31, 31, 31, 14, 28, 28, 28, 28, 28, 28,
+   31, 28, 61, 61, 31, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 14,
+   14, 31, 14, 14, 31, 14, 14, 14, 14, 14, 31, 31, 62, 14, 61, 28,
+   61, 28, 28, 28, 28, 31, 31, 61, 61, 31, 31, 61, 61, 63, 31, 31,
+   31, 31, 31, 31, 31, 28, 28, 61, 31, 31, 31, 31, 14, 14, 31, 14,
+   13, 14, 17, 17, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 28, 14, 31, 14, 14, 14, 14, 14, 14, 31, 31, 31, 14, 14,
+   14, 31, 14, 14, 14, 14, 31, 31, 31, 14, 14, 31, 14, 31, 14, 14,
+   31, 31, 31, 14, 14, 31, 31, 31, 14, 14, 14, 31, 31, 31, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 61, 61,
+   28, 61, 61, 31, 31, 31, 61, 61, 61, 31, 61, 61, 61, 63, 31, 31,
+   14, 31, 31, 31, 31, 31, 31, 61, 31, 31, 31, 31, 31, 31, 31, 31,
+   17, 17, 17, 13, 13, 13, 13, 13, 13,  3, 13, 31, 31, 31, 31, 31,
+   28, 61, 61, 61, 28, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14,
+   14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 62, 14, 28, 28,
+   28, 61, 61, 61, 61, 31, 28, 28, 28, 31, 28, 28, 28, 63, 31, 31,
+   31, 31, 31, 31, 31, 64, 65, 31, 14, 14, 14, 31, 31, 14, 31, 31,
+   31, 31, 31, 31, 31, 31, 31,  2, 17, 17, 17, 17, 17, 17, 17, 13,
+   14, 28, 61, 61,  2, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14,
+   14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 31, 31, 62, 14, 61, 28,
+   61, 61, 61, 61, 61, 31, 28, 61, 61, 31, 61, 61, 28, 63, 31, 31,
+   31, 31, 31, 31, 31, 61, 61, 31, 31, 31, 31, 31, 31, 14, 14, 31,
+   31, 14, 14, 61, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   28, 28, 61, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 63, 63, 14, 61, 61,
+   61, 28, 28, 28, 28, 31, 61, 61, 61, 31, 61, 61, 61, 63, 14, 13,
+   31, 31, 31, 31, 14, 14, 14, 61, 17, 17, 17, 17, 17, 17, 17, 14,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 13, 14, 14, 14, 14, 14, 14,
+   31, 28, 61, 61, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 14, 14, 14, 14, 14, 14,
+   14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 63, 31, 31, 31, 31, 61,
+   61, 61, 28, 28, 28, 31, 28, 31, 61, 61, 61, 61, 61, 61, 61, 61,
+   31, 31, 61, 61,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 28, 14, 14, 28, 28, 28, 28, 66, 66, 63, 31, 31, 31, 31,  3,
+   14, 14, 14, 14, 14, 14, 20, 28, 67, 67, 67, 67, 28, 28, 28,  2,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  2,  2, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 14, 14, 31, 14, 31, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14,
+   14, 14, 14, 14, 31, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 28, 14, 14, 28, 28, 28, 28, 68, 68, 63, 28, 28, 14, 31, 31,
+   14, 14, 14, 14, 14, 31, 20, 31, 69, 69, 69, 69, 28, 28, 28, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31, 14, 14, 14, 14,
+   14, 13, 13, 13,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    2,  2,  2, 13,  2, 13, 13, 13, 23, 23, 13, 13, 13, 13, 13, 13,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 13, 23, 13, 23, 13, 24,  4,  5,  4,  5, 61, 61,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31,
+   31, 70, 71, 28, 72, 28, 28, 28, 28, 28, 71, 71, 71, 71, 28, 61,
+   71, 28, 21, 21, 63,  2, 21, 21, 14, 14, 14, 14, 14, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 31, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 31, 13, 13,
+   13, 13, 13, 13, 13, 13, 23, 13, 13, 13, 13, 13, 13, 31, 13, 13,
+    2,  2,  2,  2,  2, 13, 13, 13, 13,  2,  2, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 61, 61, 28, 28, 28,
+   28, 61, 28, 28, 28, 28, 28, 62, 61, 63, 63, 61, 61, 28, 28, 14,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  2,  2,  2,  2,  2,  2,
+   14, 14, 14, 14, 14, 14, 61, 61, 28, 28, 14, 14, 14, 14, 28, 28,
+   28, 14, 61, 61, 61, 14, 14, 61, 61, 61, 61, 61, 61, 61, 14, 14,
+   14, 28, 28, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 28, 61, 61, 28, 28, 61, 61, 61, 61, 61, 61, 23, 14, 61,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 61, 61, 61, 28, 13, 13,
+    9,  9,  9,  9,  9,  9, 31,  9, 31, 31, 31, 31, 31,  9, 31, 31,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2, 20, 12, 12, 12,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 31, 14, 14, 14, 14, 31, 31,
+   14, 31, 14, 14, 14, 14, 31, 31, 14, 14, 14, 14, 14, 14, 14, 31,
+   14, 31, 14, 14, 14, 14, 31, 31, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 21, 21, 21,
+    2,  2,  2,  2,  2,  2,  2,  2,  2, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31, 31,
+    9,  9,  9,  9,  9,  9, 31, 31, 12, 12, 12, 12, 12, 12, 31, 31,
+    7, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 13,  2, 14,
+    1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  4,  5, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  2,  2,  2, 73, 73,
+   73, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 28, 28, 63, 74, 31, 31, 31, 31, 31, 31, 31, 31, 31, 14,
+   14, 14, 28, 28, 74,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14,
+   14, 31, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 28, 28, 61, 28, 28, 28, 28, 28, 28, 28, 61, 61,
+   61, 61, 61, 61, 61, 61, 28, 61, 61, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 63, 28,  2,  2,  2, 20,  2,  2,  2,  3, 14, 21, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31, 31, 31, 31, 31,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31,
+    2,  2,  2,  2,  2,  2,  7,  2,  2,  2,  2, 28, 28, 28, 16, 28,
+   14, 14, 14, 20, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 34, 14, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31,
+   28, 28, 28, 61, 61, 61, 61, 28, 28, 61, 61, 61, 31, 31, 31, 31,
+   61, 61, 28, 61, 61, 61, 61, 61, 61, 33, 21, 23, 31, 31, 31, 31,
+   13, 31, 31, 31,  2,  2,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31,
+   14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 17, 31, 31, 31, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   14, 14, 14, 14, 14, 14, 14, 21, 23, 61, 61, 28, 31, 31,  2,  2,
+   14, 14, 14, 14, 14, 61, 28, 61, 28, 28, 28, 28, 28, 28, 28, 31,
+   63, 61, 28, 61, 61, 28, 28, 28, 28, 28, 28, 28, 28, 61, 61, 61,
+   61, 61, 61, 28, 28, 21, 21, 21, 21, 21, 21, 21, 21, 31, 31, 23,
+    2,  2,  2,  2,  2,  2,  2, 20,  2,  2,  2,  2,  2,  2, 31, 31,
+   21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 21, 21, 23, 32, 23,
+   23, 21, 21, 23, 23, 21, 21, 21, 21, 21, 23, 21, 21, 21, 21, 31,
+   28, 28, 28, 28, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 62, 61, 28, 28, 28, 28, 28, 61, 28, 61, 61, 61,
+   61, 61, 28, 61, 74, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31,
+    2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 23, 21, 21, 21,
+   21, 21, 21, 21, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2, 31,
+   28, 28, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 61, 28, 28, 28, 28, 61, 61, 28, 28, 74, 63, 28, 28, 14, 14,
+   14, 14, 14, 14, 14, 14, 62, 61, 28, 28, 61, 61, 61, 28, 61, 28,
+   28, 28, 74, 74, 31, 31, 31, 31, 31, 31, 31, 31,  2,  2,  2,  2,
+   14, 14, 14, 14, 61, 61, 61, 61, 61, 61, 61, 61, 28, 28, 28, 28,
+   28, 28, 28, 28, 61, 61, 28, 62, 31, 31, 31,  2,  2,  2,  2,  2,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31, 31, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 20, 20, 20, 20, 20, 20,  2,  2,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 31, 31, 31, 31, 31, 31, 31,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 31, 31,  9,  9,  9,
+    2,  2,  2,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31,
+   21, 21, 21,  2, 26, 23, 23, 23, 23, 23, 21, 21, 23, 23, 23, 23,
+   21, 61, 26, 26, 26, 26, 26, 26, 26, 14, 14, 14, 14, 23, 14, 14,
+   14, 14, 14, 14, 21, 14, 14, 61, 21, 21, 14, 31, 31, 31, 31, 31,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 20,
+   21, 21, 23, 21, 21, 21, 21, 21, 21, 21, 23, 21, 21, 30, 75, 23,
+   25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 21, 22, 34, 34, 23, 76, 21, 29, 23, 21, 23,
+    9, 12,  9, 12,  9, 12, 12, 12, 12, 12, 12, 12, 12, 12,  9, 12,
+   12, 12, 12, 12, 12, 12, 12, 12,  9,  9,  9,  9,  9,  9,  9,  9,
+   12, 12, 12, 12, 12, 12, 31, 31,  9,  9,  9,  9,  9,  9, 31, 31,
+   12, 12, 12, 12, 12, 12, 12, 12, 31,  9, 31,  9, 31,  9, 31,  9,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 31, 31,
+   12, 12, 12, 12, 12, 12, 12, 12, 19, 19, 19, 19, 19, 19, 19, 19,
+   12, 12, 12, 12, 12, 31, 12, 12,  9,  9,  9,  9, 19, 10, 12, 10,
+   10, 10, 12, 12, 12, 31, 12, 12,  9,  9,  9,  9, 19, 10, 10, 10,
+   12, 12, 12, 12, 31, 31, 12, 12,  9,  9,  9,  9, 31, 10, 10, 10,
+   12, 12, 12, 12, 12, 12, 12, 12,  9,  9,  9,  9,  9, 10, 10, 10,
+   31, 31, 12, 12, 12, 31, 12, 12,  9,  9,  9,  9, 19, 10, 10, 31,
+    1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1, 16, 16, 16, 16, 16,
+    7,  7,  7,  7,  7,  7,  2,  2, 15, 18,  4, 15, 15, 18,  4, 15,
+    2,  2,  2,  2,  2,  2,  2,  2, 77, 78, 16, 16, 16, 16, 16,  1,
+    2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 18,  2,  2,  2,  2, 11,
+   11,  2,  2,  2,  6,  4,  5,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    2,  2,  6,  2, 11,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  1,
+   16, 16, 16, 16, 16, 31, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+   17, 20, 31, 31, 17, 17, 17, 17, 17, 17,  6,  6,  6,  4,  5, 20,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  6,  6,  6,  4,  5, 31,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 31, 31, 31,
+    3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+    3, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   21, 21, 26, 26, 21, 21, 21, 21, 26, 26, 26, 21, 21, 32, 32, 32,
+   32, 21, 32, 32, 32, 26, 26, 21, 23, 21, 26, 26, 23, 23, 23, 23,
+   21, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13,  9, 13, 13, 13, 13,  9, 13, 13, 12,  9,  9,  9, 12, 12,
+    9,  9,  9, 12, 13,  9, 13, 13,  6,  9,  9,  9,  9,  9, 13, 13,
+   13, 13, 13, 13,  9, 13,  9, 13,  9, 13,  9,  9,  9,  9, 13, 12,
+    9,  9,  9,  9, 12, 14, 14, 14, 14, 12, 13, 13, 12, 12,  9,  9,
+    6,  6,  6,  6,  6,  9, 12, 12, 12, 12, 13,  6, 13, 13, 12, 13,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+   73, 73, 73,  9, 12, 73, 73, 73, 73, 17, 13, 13, 31, 31, 31, 31,
+    6,  6,  6,  6,  6, 13, 13, 13, 13, 13,  6,  6, 13, 13, 13, 13,
+    6, 13, 13,  6, 13, 13,  6, 13, 13, 13, 13, 13, 13, 13,  6, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6,
+   13, 13,  6, 13,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   13, 13, 13, 13, 13, 13, 13, 13,  4,  5,  4,  5, 13, 13, 13, 13,
+    6,  6, 13, 13, 13, 13, 13, 13, 13,  4,  5, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6,  6,  6,  6,
+    6,  6,  6,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6,  6,  6,
+    6,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 17, 17, 17, 17, 17, 17,
+   13, 13, 13, 13, 13, 13, 13,  6, 13, 13, 13, 13, 13, 13, 13, 13,
+   13,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13,  6,  6,  6,  6,  6,  6,  6,  6,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,
+   13, 13, 13, 13, 13, 13, 13, 13,  4,  5,  4,  5,  4,  5,  4,  5,
+    4,  5,  4,  5,  4,  5, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    6,  6,  6,  6,  6,  4,  5,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  4,  5,  4,  5,  4,  5,  4,  5,  4,  5,
+    6,  6,  6,  4,  5,  4,  5,  4,  5,  4,  5,  4,  5,  4,  5,  4,
+    5,  4,  5,  4,  5,  4,  5,  4,  5,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  4,  5,  4,  5,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  5,  6,  6,
+    6,  6,  6,  6,  6, 13, 13,  6,  6,  6,  6,  6,  6, 13, 13, 13,
+   13, 13, 13, 13, 31, 31, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 31, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    9, 12,  9,  9,  9, 12, 12,  9, 12,  9, 12,  9, 12,  9,  9,  9,
+    9, 12,  9, 12, 12,  9, 12, 12, 12, 12, 12, 12, 20, 20,  9,  9,
+    9, 12,  9, 12, 12, 13, 13, 13, 13, 13, 13,  9, 12,  9, 12, 21,
+   21, 21,  9, 12, 31, 31, 31, 31, 31,  2,  2,  2,  2, 17,  2,  2,
+   12, 12, 12, 12, 12, 12, 31, 12, 31, 31, 31, 31, 31, 12, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 20,
+    2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 63,
+   14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 31,
+    2,  2, 15, 18, 15, 18,  2,  2,  2, 15, 18,  2, 15, 18,  2,  2,
+    2,  2,  2,  2,  2,  2,  2,  7,  2,  2,  7,  2, 15, 18,  2,  2,
+   15, 18,  4,  5,  4,  5,  4,  5,  4,  5,  2,  2,  2,  2,  2, 20,
+    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  2,  2,  2,  2,
+    7,  2,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+   13, 13,  2,  2,  2,  4,  5,  4,  5,  4,  5,  4,  5,  7, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31,
+    1,  2,  2,  2, 13, 20, 14, 73,  4,  5,  4,  5,  4,  5,  4,  5,
+    4,  5, 13, 13,  4,  5,  4,  5,  4,  5,  4,  5,  7,  4,  5,  5,
+   13, 73, 73, 73, 73, 73, 73, 73, 73, 73, 76, 34, 22, 33, 79, 79,
+    7, 20, 20, 20, 20, 20, 13, 13, 73, 73, 73, 20, 14,  2, 13, 13,
+   14, 14, 14, 14, 14, 14, 14, 31, 31, 80, 80, 10, 10, 20, 20, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  2, 20, 20, 20, 14,
+   31, 31, 31, 31, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   13, 13, 17, 17, 17, 17, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 17, 17, 17, 17, 17, 17, 17, 17,
+   13, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   14, 14, 14, 14, 14, 20, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 20,  2,  2,  2,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 14, 14, 31, 31, 31, 31,
+    9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12, 14, 21,
+   32, 32, 32,  2, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,  2, 20,
+    9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12, 20, 20, 21, 21,
+   14, 14, 14, 14, 14, 14, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+   21, 21,  2,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31,
+   10, 10, 10, 10, 10, 10, 10, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   10, 10,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+   12, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+   20, 12, 12, 12, 12, 12, 12, 12, 12,  9, 12,  9, 12,  9,  9, 12,
+    9, 12,  9, 12,  9, 12,  9, 12, 20, 10, 10,  9, 12,  9, 12, 14,
+    9, 12,  9, 12, 12, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+    9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9,  9,  9,  9,  9, 12,
+    9,  9,  9,  9,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,  9, 12,
+    9, 12,  9, 12,  9,  9,  9,  9, 12,  9, 12, 31, 31, 31, 31, 31,
+    9, 12, 31, 12, 31, 12,  9, 12,  9, 12, 31, 31, 31, 31, 31, 31,
+   31, 31, 20, 20, 20,  9, 12, 14, 20, 20, 12, 14, 14, 14, 14, 14,
+   14, 14, 28, 14, 14, 14, 63, 14, 14, 14, 14, 28, 14, 14, 14, 14,
+   14, 14, 14, 61, 61, 28, 28, 61, 13, 13, 13, 13, 63, 31, 31, 31,
+   17, 17, 17, 17, 17, 17, 13, 13,  3, 13, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31,
+   61, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   61, 61, 61, 61, 63, 28, 31, 31, 31, 31, 31, 31, 31, 31,  2,  2,
+   21, 21, 14, 14, 14, 14, 14, 14,  2,  2,  2, 14,  2, 14, 14, 28,
+   14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 23, 23, 23,  2,  2,
+   14, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 61, 74, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,  2,
+   14, 14, 14, 62, 61, 61, 28, 28, 28, 28, 61, 61, 28, 28, 61, 61,
+   74,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 31, 20,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31, 31, 31,  2,  2,
+   14, 14, 14, 14, 14, 28, 20, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 14, 14, 14, 14, 14, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 61,
+   61, 28, 28, 61, 61, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 28, 14, 14, 14, 14, 14, 14, 14, 14, 28, 61, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31,  2,  2,  2,  2,
+   20, 14, 14, 14, 14, 14, 14, 13, 13, 13, 14, 61, 28, 61, 14, 14,
+   21, 14, 21, 21, 23, 14, 14, 21, 21, 14, 14, 14, 14, 14, 21, 21,
+   14, 21, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 14, 14, 20,  2,  2,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 61, 28, 28, 61, 61,
+    2,  2, 14, 20, 20, 61, 63, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 14, 14, 14, 14, 14, 14, 31, 31, 14, 14, 14, 14, 14, 14, 31,
+   31, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 20, 20, 20, 20,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 10, 10, 31, 31, 31, 31,
+   14, 14, 14, 61, 61, 28, 61, 61, 28, 61, 61,  2, 61, 63, 31, 31,
+   14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 14, 14, 14, 14, 14,
+   81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   12, 12, 12, 12, 12, 12, 12, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 12, 12, 12, 12, 12, 31, 31, 31, 31, 31, 14, 83, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14,  6, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 31, 14, 31,
+   14, 14, 31, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   10, 10, 10, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  5,  4,
+   31, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 13,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  3, 13, 13, 13,
+    2,  2,  2,  2,  2,  2,  2,  4,  5,  2, 31, 31, 31, 31, 31, 31,
+   21, 21, 21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 23, 21, 21,
+    2,  7,  7, 11, 11,  4,  5,  4,  5,  4,  5,  4,  5,  4,  5,  4,
+    5,  4,  5,  4,  5,  2,  2,  4,  5,  2,  2,  2,  2, 11, 11, 11,
+    2,  2,  2, 31,  2,  2,  2,  2,  7,  4,  5,  4,  5,  4,  5,  2,
+    2,  2,  6,  7,  6,  6,  6, 31,  2,  3,  2,  2, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 16,
+   31,  2,  2,  2,  3,  2,  2,  2,  4,  5,  2,  6,  2,  7,  2,  2,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  4,  6,  5,  6,  4,
+    5,  2,  4,  5,  2,  2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   20, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 20, 20,
+   31, 31, 14, 14, 14, 14, 14, 14, 31, 31, 14, 14, 14, 14, 14, 14,
+   31, 31, 14, 14, 14, 14, 14, 14, 31, 31, 14, 14, 14, 31, 31, 31,
+    3,  3,  6, 10, 13,  3,  3, 31, 13,  6,  6,  6,  6, 13, 13, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 16, 16, 13, 13, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 31, 14,
+    2,  2,  2, 31, 31, 31, 31, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 31, 31, 31, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   73, 73, 73, 73, 73, 17, 17, 17, 17, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 17, 17, 13, 13, 13, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31,
+   13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 31, 31,
+   23, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31, 31, 31,
+   17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31, 31, 14, 14, 14,
+   14, 73, 14, 14, 14, 14, 14, 14, 14, 14, 73, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 21, 21, 21, 21, 21, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31,  2,
+   14, 14, 14, 14, 31, 31, 31, 31, 14, 14, 14, 14, 14, 14, 14, 14,
+    2, 73, 73, 73, 73, 73, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    9,  9,  9,  9,  9,  9,  9,  9, 12, 12, 12, 12, 12, 12, 12, 12,
+    9,  9,  9,  9, 31, 31, 31, 31, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,  2,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 31,  9,  9,  9,  9,
+    9,  9,  9, 31,  9,  9, 31, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 31, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 31, 12, 12, 12, 12, 12, 12, 12, 31, 12, 12, 31, 31, 31,
+   20, 20, 20, 20, 20, 20, 31, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   20, 31, 20, 20, 20, 20, 20, 20, 20, 20, 20, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 31, 31, 14, 31, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 31, 14, 14, 31, 31, 31, 14, 31, 31, 14,
+   14, 14, 14, 14, 14, 14, 31,  2, 17, 17, 17, 17, 17, 17, 17, 17,
+   14, 14, 14, 14, 14, 14, 14, 13, 13, 17, 17, 17, 17, 17, 17, 17,
+   31, 31, 31, 31, 31, 31, 31, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   14, 14, 14, 31, 14, 14, 31, 31, 31, 31, 31, 17, 17, 17, 17, 17,
+   14, 14, 14, 14, 14, 14, 17, 17, 17, 17, 17, 17, 31, 31, 31,  2,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31,  2,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 17, 17, 14, 14,
+   31, 31, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   14, 28, 28, 28, 31, 28, 28, 31, 31, 31, 31, 31, 28, 23, 28, 21,
+   14, 14, 14, 14, 31, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 31, 31, 21, 26, 23, 31, 31, 31, 31, 63,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31,
+    2,  2,  2,  2,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 17, 17,  2,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 17, 17, 17,
+   14, 14, 14, 14, 14, 14, 14, 14, 13, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 21, 23, 31, 31, 31, 31, 17, 17, 17, 17, 17,
+    2,  2,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 31, 31, 31,  2,  2,  2,  2,  2,  2,  2,
+   14, 14, 14, 14, 14, 14, 31, 31, 17, 17, 17, 17, 17, 17, 17, 17,
+   14, 14, 14, 31, 31, 31, 31, 31, 17, 17, 17, 17, 17, 17, 17, 17,
+   14, 14, 31, 31, 31, 31, 31, 31, 31,  2,  2,  2,  2, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 17, 17, 17, 17, 17, 17, 17,
+    9,  9,  9, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   12, 12, 12, 31, 31, 31, 31, 31, 31, 31, 17, 17, 17, 17, 17, 17,
+   14, 14, 14, 14, 21, 21, 21, 21, 31, 31, 31, 31, 31, 31, 31, 31,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 21, 21,  7, 31, 31,
+   14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 23, 23, 23,
+   17, 17, 17, 17, 17, 17, 17, 14, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 23, 23, 21, 21, 21, 23, 21, 23, 23, 23,
+   23, 17, 17, 17, 17,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31,
+   14, 14, 21, 23, 21, 23,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 17, 17, 17, 17, 17, 17, 17, 31, 31, 31, 31,
+   61, 28, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 63,  2,  2,  2,  2,  2,  2,  2, 31, 31,
+   17, 17, 17, 17, 17, 17,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   63, 14, 14, 28, 28, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 63,
+   61, 61, 61, 28, 28, 28, 28, 61, 61, 63, 62,  2,  2, 16,  2,  2,
+    2,  2, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 31, 31,
+   21, 21, 21, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 61, 28, 28, 28,
+   28, 28, 28, 63, 63, 31,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    2,  2,  2,  2, 14, 61, 61, 14, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 62,  2,  2, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 61, 61, 61, 28, 28, 28, 28, 28, 28, 28, 28, 28, 61,
+   74, 14, 14, 14, 14,  2,  2,  2,  2, 28, 62, 28, 28,  2, 61, 28,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 14,  2, 14,  2,  2,  2,
+   31, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 61, 61, 61, 28,
+   28, 28, 61, 61, 28, 74, 62, 28,  2,  2,  2,  2,  2,  2, 28, 14,
+   14, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 31, 14, 14, 14, 14, 31, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14,  2, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28,
+   61, 61, 61, 28, 28, 28, 28, 28, 28, 62, 63, 31, 31, 31, 31, 31,
+   28, 28, 61, 61, 31, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 14,
+   14, 31, 14, 14, 31, 14, 14, 14, 14, 14, 31, 62, 62, 14, 61, 61,
+   28, 61, 61, 61, 61, 31, 31, 61, 61, 31, 31, 61, 61, 74, 31, 31,
+   14, 31, 31, 31, 31, 31, 31, 61, 31, 31, 31, 31, 31, 14, 14, 14,
+   14, 14, 61, 61, 31, 31, 21, 21, 21, 21, 21, 21, 21, 31, 31, 31,
+   21, 21, 21, 21, 21, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 61, 61, 61, 28, 28, 28, 28, 28, 28, 28, 28,
+   61, 61, 63, 28, 28, 61, 62, 14, 14, 14, 14,  2,  2,  2,  2,  2,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  2,  2, 31,  2, 21, 14,
+   61, 61, 61, 28, 28, 28, 28, 28, 28, 61, 28, 61, 61, 61, 61, 28,
+   28, 61, 63, 62, 14, 14,  2, 14, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 61,
+   61, 61, 28, 28, 28, 28, 31, 31, 61, 61, 61, 61, 28, 28, 61, 63,
+   62,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    2,  2,  2,  2,  2,  2,  2,  2, 14, 14, 14, 14, 28, 28, 31, 31,
+   61, 61, 61, 28, 28, 28, 28, 28, 28, 28, 28, 61, 61, 28, 61, 63,
+   28,  2,  2,  2, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 61, 28, 61, 61,
+   28, 28, 28, 28, 28, 28, 74, 62, 14,  2, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 28, 28, 28,
+   61, 61, 28, 28, 28, 28, 61, 28, 28, 28, 28, 63, 31, 31, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 17, 17,  2,  2,  2, 13,
+   28, 28, 28, 28, 28, 28, 28, 28, 61, 63, 62,  2, 31, 31, 31, 31,
+   17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 14,
+   14, 14, 14, 14, 14, 14, 14, 31, 31, 14, 31, 31, 14, 14, 14, 14,
+   14, 14, 14, 14, 31, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14,
+   61, 61, 61, 61, 61, 61, 31, 61, 61, 31, 31, 28, 28, 74, 63, 14,
+   61, 14, 61, 62,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 14, 14, 14, 14, 14, 14,
+   14, 61, 61, 61, 28, 28, 28, 28, 31, 31, 28, 28, 61, 61, 61, 61,
+   63, 14,  2, 14, 61, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 14, 14, 14, 14, 14,
+   14, 14, 14, 28, 63, 28, 28, 28, 28, 61, 14, 28, 28, 28, 28,  2,
+    2,  2,  2,  2,  2,  2,  2, 63, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 28, 28, 28, 28, 28, 28, 61, 61, 28, 28, 28, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 61, 28, 63,  2,  2,  2, 14,  2,  2,
+    2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31,
+   28, 28, 28, 28, 28, 28, 28, 31, 28, 28, 28, 28, 28, 28, 61, 63,
+   14,  2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    2,  2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   31, 31, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 31, 61, 28, 28, 28, 28, 28, 28,
+   28, 61, 28, 28, 61, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 31, 14, 14, 14, 14, 14,
+   14, 28, 28, 28, 28, 28, 28, 31, 31, 31, 28, 31, 28, 28, 31, 28,
+   28, 28, 62, 28, 63, 63, 14, 28, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 31, 14, 14, 31, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 61, 61, 61, 61, 61, 31,
+   28, 28, 31, 61, 61, 28, 61, 63, 14, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 28, 28, 61, 61,  2,  2, 31, 31, 31, 31, 31, 31, 31,
+   28, 28, 14, 61, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 61, 61, 28, 28, 28, 28, 28, 31, 31, 31, 61, 61,
+   28, 74, 63,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+   17, 17, 17, 17, 17, 13, 13, 13, 13, 13, 13, 13, 13,  3,  3,  3,
+    3, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,  2,
+   73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 31,
+    2,  2,  2,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14,  2,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+   28, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   26, 26, 26, 26, 26,  2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   21, 21, 21, 21, 21, 21, 21,  2,  2,  2,  2,  2, 13, 13, 13, 13,
+   20, 20, 20, 20,  2, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 17, 17, 17, 17, 17,
+   17, 17, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 31, 14, 14, 14,
+   17, 17, 17, 17, 17, 17, 17,  2,  2,  2,  2, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 31, 31, 28,
+   14, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   61, 61, 61, 61, 61, 61, 61, 61, 31, 31, 31, 31, 31, 31, 31, 28,
+   28, 28, 28, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   20, 20,  2, 20, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   84, 84, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   20, 20, 20, 20, 31, 20, 20, 20, 20, 20, 20, 20, 31, 20, 20, 31,
+   14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 31, 31, 14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 31, 14, 14, 14, 14, 31, 31, 31, 31, 31, 31, 31, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 31, 13, 28, 26,  2,
+   16, 16, 16, 16, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 31, 31,
+   28, 28, 28, 28, 28, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 31, 31, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 85, 85, 26, 26, 26, 13, 13, 13, 86, 85, 85,
+   85, 85, 85, 16, 16, 16, 16, 16, 16, 16, 16, 23, 23, 23, 23, 23,
+   23, 23, 23, 13, 13, 21, 21, 21, 21, 21, 23, 23, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 21, 21, 21, 13, 13,
+   13, 13, 21, 21, 21, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 12, 12,
+   12, 12, 12, 12, 12, 31, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    9,  9, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  9, 31,  9,  9,
+   31, 31,  9, 31, 31,  9,  9, 31, 31,  9,  9,  9,  9, 31,  9,  9,
+    9,  9,  9,  9,  9,  9, 12, 12, 12, 12, 31, 12, 31, 12, 12, 12,
+   12, 12, 12, 12, 31, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12,  9,  9, 31,  9,  9,  9,  9, 31, 31,  9,  9,  9,
+    9,  9,  9,  9,  9, 31,  9,  9,  9,  9,  9,  9,  9, 31, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12,  9,  9, 31,  9,  9,  9,  9, 31,
+    9,  9,  9,  9,  9, 31,  9, 31, 31, 31,  9,  9,  9,  9,  9,  9,
+    9, 31, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 31, 31,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  6, 12, 12, 12, 12,
+   12, 12,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  6, 12, 12, 12, 12,
+   12, 12, 12, 12, 12,  6, 12, 12, 12, 12, 12, 12,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  6,
+   12, 12, 12, 12, 12, 12,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  6,
+   12, 12, 12, 12, 12, 12, 12, 12, 12,  6, 12, 12, 12, 12, 12, 12,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  6, 12, 12, 12, 12, 12, 12,
+   12, 12, 12,  6, 12, 12, 12, 12, 12, 12,  9, 12, 31, 31,  8,  8,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   28, 28, 28, 28, 28, 28, 28, 13, 13, 13, 13, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 13, 13, 13,
+   13, 13, 13, 13, 13, 28, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 28, 13, 13,  2,  2,  2,  2,  2, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 28, 28, 28, 28, 28,
+   31, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 31,
+   31, 31, 31, 31, 31, 12, 12, 12, 12, 12, 12, 31, 31, 31, 31, 31,
+   21, 21, 21, 21, 21, 21, 21, 31, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 31, 31, 21, 21, 21, 21, 21,
+   21, 21, 31, 21, 21, 31, 21, 21, 21, 21, 21, 31, 31, 31, 31, 31,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 21,
+   21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20, 31, 31,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31, 31, 31, 14, 13,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 21, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 21, 21, 21, 21,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8, 31, 31, 31, 31, 31,  3,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 20, 22, 22, 23, 21,
+   14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 31, 14, 14, 31,
+   14, 14, 14, 14, 14, 31, 31, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   23, 23, 23, 23, 23, 23, 23, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   12, 12, 12, 12, 21, 21, 21, 21, 21, 21, 62, 20, 31, 31, 31, 31,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 13, 17, 17, 17,
+    3, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 13, 17,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31,
+   14, 14, 14, 14, 31, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   31, 14, 14, 31, 14, 31, 31, 14, 31, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 31, 14, 14, 14, 14, 31, 14, 31, 14, 31, 31, 31, 31,
+   31, 31, 14, 31, 31, 31, 31, 14, 31, 14, 31, 14, 31, 14, 14, 14,
+   31, 14, 14, 31, 14, 31, 31, 14, 31, 14, 31, 14, 31, 14, 31, 14,
+   31, 14, 14, 31, 14, 31, 31, 14, 14, 14, 14, 31, 14, 14, 14, 14,
+   14, 14, 14, 31, 14, 14, 14, 14, 31, 14, 14, 14, 14, 31, 14, 31,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14,
+   31, 14, 14, 14, 31, 14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 14,
+    6,  6, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 31,
+   31, 31, 31, 31, 31, 31, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10,
+   13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31, 31, 31, 31,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 31, 13,
+   13, 13, 13, 13, 13, 13, 31, 31, 31, 31, 31, 31, 31, 31, 13, 13,
+   13, 13, 13, 31, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   31, 16, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 31, 31,
+};
+static const uint16_t
+_hb_ucd_props_map[87] =
+{
+       0,    29,    21,    23,    22,    18,    25,    17,    13,     9,    24,    16,     5,    26,     7,    20,
+       1,    15,    19,     8,     6, 58892, 59404, 56332, 55308, 51724,   268, 61452,    12, 59660, 59916,     2,
+      11, 56844, 58380,  2572,  2828,  3084,  3340,  3596,  3852,  4108,  4364,  4620,  4876,  5132,  5388,  5644,
+    5900,  6156,  6412,  7692,  7948,  8204,  6924,  7180,  7436,  8460,  8716,  8972,  9228,    10,  1804,  2316,
+   21516, 23308, 26380, 27404, 30220, 31244, 33036, 33292, 33804,    14,  2314, 54796, 55820,    27,    28, 57354,
+    2060,     4,     3,  6668,  1546, 55306, 57866,
+};
+
+static inline uint_fast16_t
+_hb_ucd_props (unsigned u)
+{
+  return u<1114112u?_hb_ucd_props_map[_hb_ucd_props_u8[(_hb_ucd_props_u16[(_hb_ucd_props_page[u>>9]<<5)+((u>>4)&31u)]<<4)+((u)&15u)]]:2;
+}
+
 #elif !defined(HB_NO_UCD_UNASSIGNED)
 
 static const uint8_t
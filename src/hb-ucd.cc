@@ -25,7 +25,11 @@ hb_ucd_combining_class (hb_unicode_funcs_t *ufuncs HB_UNUSED,
 			hb_codepoint_t unicode,
 			void *user_data HB_UNUSED)
 {
+#ifndef HB_OPTIMIZE_SIZE
+  return (hb_unicode_combining_class_t) (_hb_ucd_props (unicode) >> 8);
+#else
   return (hb_unicode_combining_class_t) _hb_ucd_ccc (unicode);
+#endif
 }
 
 static hb_unicode_general_category_t
@@ -33,7 +37,43 @@ hb_ucd_general_category (hb_unicode_funcs_t *ufuncs HB_UNUSED,
 			 hb_codepoint_t unicode,
 			 void *user_data HB_UNUSED)
 {
+#ifndef HB_OPTIMIZE_SIZE
+  return (hb_unicode_general_category_t) (_hb_ucd_props (unicode) & 0xFFu);
+#else
   return (hb_unicode_general_category_t) _hb_ucd_gc (unicode);
+#endif
+}
+
+static void
+hb_ucd_props_bulk (hb_unicode_funcs_t   *ufuncs HB_UNUSED,
+		   unsigned int          count,
+		   const hb_codepoint_t *first_unicode,
+		   unsigned int          unicode_stride,
+		   uint16_t             *first_props,
+		   unsigned int          props_stride)
+{
+  for (unsigned int i = 0; i < count; i++)
+  {
+    hb_codepoint_t u = *first_unicode;
+    if (likely (u < 0x80u))
+      *first_props = _hb_ascii_general_category[u];
+    else
+    {
+#ifndef HB_OPTIMIZE_SIZE
+      /* Fused table; only marks have a non-zero combining class. */
+      *first_props = _hb_ucd_props (u);
+#else
+      unsigned int gen_cat = _hb_ucd_gc (u);
+      unsigned int props = gen_cat;
+      if (HB_UNICODE_GENERAL_CATEGORY_IS_MARK (gen_cat))
+	props |= _hb_ucd_ccc (u) << 8;
+      *first_props = props;
+#endif
+    }
+
+    first_unicode = &StructAtOffsetUnaligned<hb_codepoint_t> (first_unicode, unicode_stride);
+    first_props = &StructAtOffsetUnaligned<uint16_t> (first_props, props_stride);
+  }
 }
 
 static hb_codepoint_t
@@ -167,6 +207,36 @@ hb_ucd_compose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
   return true;
 }
 
+static int
+_cmp_codepoint (const void *_key, const void *_item)
+{
+  uint32_t a = * (uint32_t*) _key;
+  uint32_t b = * (uint32_t*) _item;
+
+  return a < b ? -1 : a > b ? +1 : 0;
+}
+
+static hb_bool_t
+hb_ucd_compose_quick_check (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+			    hb_codepoint_t      b)
+{
+  /* Hangul V and T jamo compose with a preceding L and LV. */
+  if ((b >= VBASE && b < VBASE + VCOUNT) || (b > TBASE && b < TBASE + TCOUNT))
+    return true;
+
+  /* Anything else that hb_ucd_compose() can compose as "b" is in this
+   * sorted array; reject what falls outside its range first. */
+  const hb_codepoint_t first = _hb_ucd_cq_map[0];
+  const hb_codepoint_t last = _hb_ucd_cq_map[ARRAY_LENGTH (_hb_ucd_cq_map) - 1];
+  if (b - first > last - first) return false;
+  uint32_t k = b;
+  return !!hb_bsearch (k,
+		       _hb_ucd_cq_map,
+		       ARRAY_LENGTH (_hb_ucd_cq_map),
+		       sizeof (*_hb_ucd_cq_map),
+		       _cmp_codepoint);
+}
+
 static hb_bool_t
 hb_ucd_decompose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
 		  hb_codepoint_t ab, hb_codepoint_t *a, hb_codepoint_t *b,
@@ -234,6 +304,13 @@ static struct hb_ucd_unicode_funcs_lazy_loader_t : hb_unicode_funcs_lazy_loader_
     hb_unicode_funcs_set_compose_func (funcs, hb_ucd_compose, nullptr, nullptr);
     hb_unicode_funcs_set_decompose_func (funcs, hb_ucd_decompose, nullptr, nullptr);
 
+    funcs->bulk.props = hb_ucd_props_bulk;
+    funcs->bulk.general_category = hb_ucd_general_category;
+    funcs->bulk.combining_class = hb_ucd_combining_class;
+    funcs->bulk.script = hb_ucd_script;
+    funcs->bulk.compose_quick_check = hb_ucd_compose_quick_check;
+    funcs->bulk.compose = hb_ucd_compose;
+
     hb_unicode_funcs_make_immutable (funcs);
 
     hb_atexit (free_static_ucd_funcs);
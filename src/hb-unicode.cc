@@ -31,6 +31,7 @@
 #include "hb.hh"
 
 #include "hb-unicode.hh"
+#include "hb-utf.hh"
 
 
 /**
@@ -199,6 +200,8 @@ hb_unicode_funcs_create (hb_unicode_funcs_t *parent)
    * though. */
   ufuncs->user_data = parent->user_data;
 
+  ufuncs->bulk = parent->bulk;
+
   return ufuncs;
 }
 
@@ -494,6 +497,335 @@ hb_unicode_decompose_compatibility (hb_unicode_funcs_t *ufuncs,
 #endif
 
 
+/*
+ * Script itemization
+ */
+
+/* How ASCII characters affect a script run: 0 is Common, 1 is Latin and
+ * 2 is a bracket, which must go through the pairing logic. */
+static const uint8_t
+_hb_ascii_script_class[128] =
+{
+  /* 0x00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x20 */ 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+  /* 0x30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  /* 0x40 */ 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  /* 0x50 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 2, 0, 0,
+  /* 0x60 */ 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  /* 0x70 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 2, 0, 0,
+};
+
+static inline bool
+_hb_script_is_weak (hb_script_t script)
+{
+  return script == HB_SCRIPT_COMMON ||
+	 script == HB_SCRIPT_INHERITED ||
+	 script == HB_SCRIPT_UNKNOWN;
+}
+
+template <typename utf_t>
+static unsigned int
+_hb_unicode_script_runs (hb_unicode_funcs_t                *ufuncs,
+			 const typename utf_t::codepoint_t *text,
+			 int                                text_length,
+			 unsigned int                       start_offset,
+			 unsigned int                      *run_count /* IN/OUT */,
+			 hb_script_run_t                   *runs /* OUT */)
+{
+  typedef typename utf_t::codepoint_t T;
+
+  if (!ufuncs)
+    ufuncs = hb_unicode_funcs_get_default ();
+  if (text_length == -1)
+    text_length = utf_t::strlen (text);
+
+  unsigned int max_runs = run_count ? *run_count : 0;
+  unsigned int total = 0;
+  auto emit = [&] (const T *start, const T *end, hb_script_t script)
+  {
+    if (total >= start_offset && total - start_offset < max_runs)
+    {
+      hb_script_run_t *run = &runs[total - start_offset];
+      run->offset = start - text;
+      run->length = end - start;
+      run->script = script;
+    }
+    total++;
+  };
+
+  /* With the built-in functions, ASCII is classified by table, and spans
+   * of it that can neither end the run nor touch the bracket stack are
+   * skipped without decoding. */
+  bool ascii_fast = ufuncs->bulk.script &&
+		    ufuncs->bulk.script == ufuncs->func.script &&
+		    ufuncs->bulk.general_category == ufuncs->func.general_category;
+
+  /* Open brackets seen so far, with the script they were opened in, so
+   * that the matching close bracket gets the same script.  Entries above
+   * fixup_top were pushed before the current run got a real script, and
+   * take on that script once it does.  On overflow the outermost entry is
+   * dropped. */
+  struct
+  {
+    hb_codepoint_t close;
+    hb_script_t script;
+  } stack[32];
+  int top = -1, fixup_top = -1;
+
+  const T *p = text, *end = text + text_length;
+  const T *run_start = p;
+  hb_script_t run_script = HB_SCRIPT_COMMON;
+  while (p < end)
+  {
+    if (ascii_fast)
+    {
+      unsigned int skip_class = run_script == HB_SCRIPT_LATIN ? 1 : 0;
+      while (p < end && *p < 0x80u && _hb_ascii_script_class[*p] <= skip_class)
+	p++;
+      if (p == end)
+	break;
+    }
+
+    hb_codepoint_t u;
+    const T *next = utf_t::next (p, end, &u, HB_BUFFER_REPLACEMENT_CODEPOINT_DEFAULT);
+
+    hb_script_t script;
+    hb_unicode_general_category_t gen_cat;
+    if (ascii_fast && u < 0x80u)
+    {
+      script = _hb_ascii_script_class[u] == 1 ? HB_SCRIPT_LATIN : HB_SCRIPT_COMMON;
+      gen_cat = (hb_unicode_general_category_t) _hb_ascii_general_category[u];
+    }
+    else
+    {
+      script = ufuncs->script (u);
+      if (script == run_script && script != HB_SCRIPT_COMMON)
+      {
+	/* Same-script span; nothing to do until the script changes. */
+	for (p = next; p < end && *p >= 0x80u; p = next)
+	{
+	  next = utf_t::next (p, end, &u, HB_BUFFER_REPLACEMENT_CODEPOINT_DEFAULT);
+	  if (ufuncs->script (u) != run_script)
+	    break;
+	}
+	continue;
+      }
+      gen_cat = script == HB_SCRIPT_COMMON ? ufuncs->general_category (u)
+					    : HB_UNICODE_GENERAL_CATEGORY_UNASSIGNED;
+    }
+
+    bool matched_close = false;
+    if (gen_cat == HB_UNICODE_GENERAL_CATEGORY_OPEN_PUNCTUATION)
+    {
+      hb_codepoint_t close = ufuncs->mirroring (u);
+      if (close != u)
+      {
+	if (top == (int) ARRAY_LENGTH (stack) - 1)
+	{
+	  memmove (stack, stack + 1, top * sizeof (stack[0]));
+	  top--;
+	  if (fixup_top >= 0) fixup_top--;
+	}
+	top++;
+	stack[top].close = close;
+	stack[top].script = run_script;
+      }
+    }
+    else if (gen_cat == HB_UNICODE_GENERAL_CATEGORY_CLOSE_PUNCTUATION)
+    {
+      while (top >= 0 && stack[top].close != u)
+	top--;
+      fixup_top = hb_min (fixup_top, top);
+      if (top >= 0)
+      {
+	script = stack[top].script;
+	matched_close = true;
+      }
+    }
+
+    if (_hb_script_is_weak (script) || script == run_script)
+      ;
+    else if (_hb_script_is_weak (run_script))
+    {
+      /* Common and Inherited characters at the start of the run take on
+       * the first real script that follows them. */
+      run_script = script;
+      for (int i = fixup_top + 1; i <= top; i++)
+	stack[i].script = script;
+    }
+    else
+    {
+      emit (run_start, p, run_script);
+      run_start = p;
+      run_script = script;
+      fixup_top = top;
+    }
+
+    if (matched_close)
+    {
+      top--;
+      fixup_top = hb_min (fixup_top, top);
+    }
+
+    p = next;
+  }
+  if (run_start < end)
+    emit (run_start, end, run_script);
+
+  if (run_count)
+    *run_count = total > start_offset ? hb_min (max_runs, total - start_offset) : 0;
+  return total;
+}
+
+/**
+ * hb_unicode_script_runs_utf8:
+ * @ufuncs: (nullable): The Unicode-functions structure, or `NULL` for the
+ *   default functions
+ * @text: (array length=text_length) (element-type uint8_t): An array of UTF-8
+ *   characters
+ * @text_length: The length of the @text, or -1 if it is `NULL` terminated
+ * @start_offset: The index of the first run to return
+ * @run_count: (inout) (optional): Input = the maximum number of runs to
+ *   return; Output = the actual number of runs returned (may be zero)
+ * @runs: (out caller-allocates) (array length=run_count): The runs found
+ *
+ * Splits @text into maximal runs of a single script, using the Script
+ * property from @ufuncs.
+ *
+ * Characters with a Common, Inherited or Unknown script take on the
+ * script of the run they are in; at the start of the text they take on
+ * the first real script that follows.  A closing bracket takes on the
+ * script of its matching opening bracket, so that parenthesized text in
+ * another script does not pull the parentheses along.  Text that has no
+ * real script at all makes a single #HB_SCRIPT_COMMON run.
+ *
+ * Ill-formed UTF-8 is treated as U+FFFD, which is Common.
+ *
+ * The runs are not split by direction; that is left to the bidi
+ * algorithm, and hb_script_get_horizontal_direction() gives the direction
+ * of each run's script.
+ *
+ * Return value: Total number of runs in @text
+ *
+ * Since: REPLACEME
+ **/
+unsigned int
+hb_unicode_script_runs_utf8 (hb_unicode_funcs_t *ufuncs,
+			     const char         *text,
+			     int                 text_length,
+			     unsigned int        start_offset,
+			     unsigned int       *run_count /* IN/OUT */,
+			     hb_script_run_t    *runs /* OUT */)
+{
+  return _hb_unicode_script_runs<hb_utf8_t> (ufuncs, (const uint8_t *) text, text_length,
+					     start_offset, run_count, runs);
+}
+
+/**
+ * hb_unicode_script_runs_utf16:
+ * @ufuncs: (nullable): The Unicode-functions structure, or `NULL` for the
+ *   default functions
+ * @text: (array length=text_length): An array of UTF-16 characters
+ * @text_length: The length of the @text, or -1 if it is `NULL` terminated
+ * @start_offset: The index of the first run to return
+ * @run_count: (inout) (optional): Input = the maximum number of runs to
+ *   return; Output = the actual number of runs returned (may be zero)
+ * @runs: (out caller-allocates) (array length=run_count): The runs found
+ *
+ * Splits @text into maximal runs of a single script.  See
+ * hb_unicode_script_runs_utf8() for the details; offsets are in UTF-16
+ * code units.
+ *
+ * Return value: Total number of runs in @text
+ *
+ * Since: REPLACEME
+ **/
+unsigned int
+hb_unicode_script_runs_utf16 (hb_unicode_funcs_t *ufuncs,
+			      const uint16_t     *text,
+			      int                 text_length,
+			      unsigned int        start_offset,
+			      unsigned int       *run_count /* IN/OUT */,
+			      hb_script_run_t    *runs /* OUT */)
+{
+  return _hb_unicode_script_runs<hb_utf16_t> (ufuncs, text, text_length,
+					      start_offset, run_count, runs);
+}
+
+/**
+ * hb_unicode_script_runs_utf32:
+ * @ufuncs: (nullable): The Unicode-functions structure, or `NULL` for the
+ *   default functions
+ * @text: (array length=text_length): An array of UTF-32 characters
+ * @text_length: The length of the @text, or -1 if it is `NULL` terminated
+ * @start_offset: The index of the first run to return
+ * @run_count: (inout) (optional): Input = the maximum number of runs to
+ *   return; Output = the actual number of runs returned (may be zero)
+ * @runs: (out caller-allocates) (array length=run_count): The runs found
+ *
+ * Splits @text into maximal runs of a single script.  See
+ * hb_unicode_script_runs_utf8() for the details; offsets are in UTF-32
+ * code units.
+ *
+ * Return value: Total number of runs in @text
+ *
+ * Since: REPLACEME
+ **/
+unsigned int
+hb_unicode_script_runs_utf32 (hb_unicode_funcs_t *ufuncs,
+			      const uint32_t     *text,
+			      int                 text_length,
+			      unsigned int        start_offset,
+			      unsigned int       *run_count /* IN/OUT */,
+			      hb_script_run_t    *runs /* OUT */)
+{
+  return _hb_unicode_script_runs<hb_utf32_t> (ufuncs, text, text_length,
+					      start_offset, run_count, runs);
+}
+
+
+/* General_Category of the ASCII characters, for table-driven fast paths. */
+#define Cc HB_UNICODE_GENERAL_CATEGORY_CONTROL
+#define Ll HB_UNICODE_GENERAL_CATEGORY_LOWERCASE_LETTER
+#define Lu HB_UNICODE_GENERAL_CATEGORY_UPPERCASE_LETTER
+#define Nd HB_UNICODE_GENERAL_CATEGORY_DECIMAL_NUMBER
+#define Pc HB_UNICODE_GENERAL_CATEGORY_CONNECT_PUNCTUATION
+#define Pd HB_UNICODE_GENERAL_CATEGORY_DASH_PUNCTUATION
+#define Pe HB_UNICODE_GENERAL_CATEGORY_CLOSE_PUNCTUATION
+#define Po HB_UNICODE_GENERAL_CATEGORY_OTHER_PUNCTUATION
+#define Ps HB_UNICODE_GENERAL_CATEGORY_OPEN_PUNCTUATION
+#define Sc HB_UNICODE_GENERAL_CATEGORY_CURRENCY_SYMBOL
+#define Sk HB_UNICODE_GENERAL_CATEGORY_MODIFIER_SYMBOL
+#define Sm HB_UNICODE_GENERAL_CATEGORY_MATH_SYMBOL
+#define Zs HB_UNICODE_GENERAL_CATEGORY_SPACE_SEPARATOR
+const uint8_t
+_hb_ascii_general_category[128] =
+{
+  /* 0x00 */ Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc,
+  /* 0x10 */ Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc,
+  /* 0x20 */ Zs, Po, Po, Po, Sc, Po, Po, Po, Ps, Pe, Po, Sm, Po, Pd, Po, Po,
+  /* 0x30 */ Nd, Nd, Nd, Nd, Nd, Nd, Nd, Nd, Nd, Nd, Po, Po, Sm, Sm, Sm, Po,
+  /* 0x40 */ Po, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu,
+  /* 0x50 */ Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, Ps, Po, Pe, Sk, Pc,
+  /* 0x60 */ Sk, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll,
+  /* 0x70 */ Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ps, Sm, Pe, Sm, Cc,
+};
+#undef Cc
+#undef Ll
+#undef Lu
+#undef Nd
+#undef Pc
+#undef Pd
+#undef Pe
+#undef Po
+#undef Ps
+#undef Sc
+#undef Sk
+#undef Sm
+#undef Zs
+
+
 #ifndef HB_NO_OT_SHAPE
 /* See hb-unicode.hh for details. */
 const uint8_t
@@ -638,6 +638,49 @@ hb_unicode_decompose (hb_unicode_funcs_t *ufuncs,
 		      hb_codepoint_t     *a,
 		      hb_codepoint_t     *b);
 
+/**
+ * hb_script_run_t:
+ * @offset: start of the run, in code units from the start of the text
+ * @length: length of the run, in code units
+ * @script: the script of the run
+ *
+ * A maximal run of text in a single script, as returned by
+ * hb_unicode_script_runs_utf8() and friends.  Offsets and lengths are in
+ * the code units of the text passed in, so they can be passed directly to
+ * hb_buffer_add_utf8() and friends as @item_offset and @item_length.
+ *
+ * Since: REPLACEME
+ **/
+typedef struct hb_script_run_t {
+  unsigned int offset;
+  unsigned int length;
+  hb_script_t  script;
+} hb_script_run_t;
+
+HB_EXTERN unsigned int
+hb_unicode_script_runs_utf8 (hb_unicode_funcs_t *ufuncs,
+			     const char         *text,
+			     int                 text_length,
+			     unsigned int        start_offset,
+			     unsigned int       *run_count /* IN/OUT */,
+			     hb_script_run_t    *runs /* OUT */);
+
+HB_EXTERN unsigned int
+hb_unicode_script_runs_utf16 (hb_unicode_funcs_t *ufuncs,
+			      const uint16_t     *text,
+			      int                 text_length,
+			      unsigned int        start_offset,
+			      unsigned int       *run_count /* IN/OUT */,
+			      hb_script_run_t    *runs /* OUT */);
+
+HB_EXTERN unsigned int
+hb_unicode_script_runs_utf32 (hb_unicode_funcs_t *ufuncs,
+			      const uint32_t     *text,
+			      int                 text_length,
+			      unsigned int        start_offset,
+			      unsigned int       *run_count /* IN/OUT */,
+			      hb_script_run_t    *runs /* OUT */);
+
 HB_END_DECLS
 
 #endif /* HB_UNICODE_H */
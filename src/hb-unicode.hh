@@ -35,6 +35,7 @@
 
 
 extern HB_INTERNAL const uint8_t _hb_modified_combining_class[256];
+extern HB_INTERNAL const uint8_t _hb_ascii_general_category[128];
 
 /*
  * hb_unicode_funcs_t
@@ -60,6 +61,23 @@ extern HB_INTERNAL const uint8_t _hb_modified_combining_class[256];
   HB_UNICODE_FUNC_IMPLEMENT (hb_script_t, script) \
   /* ^--- Add new simple callbacks here */
 
+/* Batched Unicode property lookup: for each of @count codepoints, @unicode_stride
+ * bytes apart, writes its general category to the low byte of a 16-bit slot,
+ * @props_stride bytes apart, and, if it is a mark, its combining class to
+ * the high byte.  Internal; installed by the built-in implementations. */
+typedef void (*hb_unicode_props_bulk_func_t) (hb_unicode_funcs_t   *ufuncs,
+						unsigned int          count,
+						const hb_codepoint_t *first_unicode,
+						unsigned int          unicode_stride,
+						uint16_t             *first_props,
+						unsigned int          props_stride);
+
+/* Composition quick check: returns false if @unicode can never be the second
+ * character of a successful compose() call.  Internal; installed by the
+ * built-in implementations. */
+typedef hb_bool_t (*hb_unicode_compose_quick_check_func_t) (hb_unicode_funcs_t *ufuncs,
+							      hb_codepoint_t      unicode);
+
 struct hb_unicode_funcs_t
 {
   hb_object_header_t header;
@@ -71,6 +89,12 @@ struct hb_unicode_funcs_t
 HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
 #undef HB_UNICODE_FUNC_IMPLEMENT
 
+  inline void props_bulk (unsigned int          count,
+			  const hb_codepoint_t *first_unicode,
+			  unsigned int          unicode_stride,
+			  uint16_t             *first_props,
+			  unsigned int          props_stride);
+
   hb_bool_t compose (hb_codepoint_t a, hb_codepoint_t b,
 		     hb_codepoint_t *ab)
   {
@@ -79,6 +103,13 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
     return func.compose (this, a, b, ab, user_data.compose);
   }
 
+  bool may_compose_with_previous (hb_codepoint_t unicode)
+  {
+    return !bulk.compose_quick_check ||
+	   bulk.compose != func.compose ||
+	   bulk.compose_quick_check (this, unicode);
+  }
+
   hb_bool_t decompose (hb_codepoint_t ab,
 		       hb_codepoint_t *a, hb_codepoint_t *b)
   {
@@ -104,6 +135,10 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
 
   unsigned int
   modified_combining_class (hb_codepoint_t u)
+  { return modified_combining_class (u, combining_class (u)); }
+
+  static unsigned int
+  modified_combining_class (hb_codepoint_t u, unsigned int combining_class)
   {
     /* Reorder SAKOT to ensure it comes after any tone marks. */
     if (unlikely (u == 0x1A60u)) return 254;
@@ -112,7 +147,7 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
     /* Reorder TSA -PHRU to reorder before U+0F74 */
     if (unlikely (u == 0x0F39u)) return 127;
 
-    return _hb_modified_combining_class[combining_class (u)];
+    return _hb_modified_combining_class[combining_class];
   }
 
   static hb_bool_t
@@ -258,6 +293,18 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
     HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS
 #undef HB_UNICODE_FUNC_IMPLEMENT
   } destroy;
+
+  /* Batched lookups and quick checks.  Only used while the callbacks they
+   * stand in for are still in place, so overriding those in a child
+   * disables them. */
+  struct {
+    hb_unicode_props_bulk_func_t props;
+    hb_unicode_general_category_func_t general_category;
+    hb_unicode_combining_class_func_t combining_class;
+    hb_unicode_script_func_t script;
+    hb_unicode_compose_quick_check_func_t compose_quick_check;
+    hb_unicode_compose_func_t compose;
+  } bulk;
 };
 DECLARE_NULL_INSTANCE (hb_unicode_funcs_t);
 
@@ -365,6 +412,37 @@ DECLARE_NULL_INSTANCE (hb_unicode_funcs_t);
 	  FLAG (HB_UNICODE_GENERAL_CATEGORY_TITLECASE_LETTER) | \
 	  FLAG (HB_UNICODE_GENERAL_CATEGORY_UPPERCASE_LETTER)))
 
+inline void
+hb_unicode_funcs_t::props_bulk (unsigned int          count,
+				const hb_codepoint_t *first_unicode,
+				unsigned int          unicode_stride,
+				uint16_t             *first_props,
+				unsigned int          props_stride)
+{
+  if (bulk.props &&
+      bulk.general_category == func.general_category &&
+      bulk.combining_class == func.combining_class)
+  {
+    bulk.props (this, count,
+		first_unicode, unicode_stride,
+		first_props, props_stride);
+    return;
+  }
+
+  for (unsigned int i = 0; i < count; i++)
+  {
+    hb_codepoint_t u = *first_unicode;
+    unsigned int gen_cat = general_category (u);
+    unsigned int props = gen_cat;
+    if (HB_UNICODE_GENERAL_CATEGORY_IS_MARK (gen_cat))
+      props |= (combining_class (u) & 0xFFu) << 8;
+    *first_props = props;
+
+    first_unicode = (const hb_codepoint_t *) ((const char *) first_unicode + unicode_stride);
+    first_props = (uint16_t *) ((char *) first_props + props_stride);
+  }
+}
+
 /*
  * Ranges, used for bsearch tables.
  */
@@ -37,6 +37,7 @@
 #include "hb-font.h"
 #include "hb-map.h"
 #include "hb-paint.h"
+#include "hb-raster.h"
 #include "hb-set.h"
 #include "hb-shape.h"
 #include "hb-shape-plan.h"
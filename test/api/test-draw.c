@@ -26,6 +26,7 @@
 #include <math.h>
 
 #include <hb.h>
+#include <hb-ot.h>
 #ifdef HAVE_FREETYPE
 #include <hb-ft.h>
 #endif
@@ -246,6 +247,116 @@ test_hb_draw_glyf (void)
   hb_font_destroy (font);
 }
 
+static void
+_replay_path (const uint8_t *verbs, unsigned verbs_length,
+	      const float *coords, unsigned coords_length,
+	      hb_draw_funcs_t *dfuncs, draw_data_t *draw_data)
+{
+  hb_draw_state_t st = HB_DRAW_STATE_DEFAULT;
+  const float *p = coords;
+  for (unsigned i = 0; i < verbs_length; i++)
+    switch (verbs[i])
+    {
+    case HB_DRAW_VERB_MOVE_TO:
+      hb_draw_move_to (dfuncs, draw_data, &st, p[0], p[1]);
+      p += 2;
+      break;
+    case HB_DRAW_VERB_LINE_TO:
+      hb_draw_line_to (dfuncs, draw_data, &st, p[0], p[1]);
+      p += 2;
+      break;
+    case HB_DRAW_VERB_QUADRATIC_TO:
+      hb_draw_quadratic_to (dfuncs, draw_data, &st, p[0], p[1], p[2], p[3]);
+      p += 4;
+      break;
+    case HB_DRAW_VERB_CUBIC_TO:
+      hb_draw_cubic_to (dfuncs, draw_data, &st, p[0], p[1], p[2], p[3], p[4], p[5]);
+      p += 6;
+      break;
+    case HB_DRAW_VERB_CLOSE_PATH:
+      hb_draw_close_path (dfuncs, draw_data, &st);
+      break;
+    default:
+      g_assert_not_reached ();
+    }
+  g_assert_cmpuint (p - coords, ==, coords_length);
+}
+
+static void
+test_hb_draw_glyph_path (void)
+{
+  hb_face_t *face = hb_test_open_font_file ("fonts/SourceSerifVariable-Roman-VVAR.abc.ttf");
+  hb_font_t *font = hb_font_create (face);
+  hb_face_destroy (face);
+
+  char str[1024];
+  draw_data_t draw_data = {
+    .str = str,
+    .size = sizeof (str),
+    .consumed = 0
+  };
+  char str2[1024];
+  draw_data_t draw_data2 = {
+    .str = str2,
+    .size = sizeof (str2),
+    .consumed = 0
+  };
+  uint8_t verbs[64];
+  float coords[256];
+  unsigned verbs_length, coords_length;
+
+  /* Too small arrays are filled as far as they go, and the full
+   * lengths are returned. */
+  verbs_length = 4;
+  coords_length = 6;
+  g_assert_false (hb_font_get_glyph_path (font, 3, HB_DRAW_PATH_FLAG_DEFAULT,
+					  &verbs_length, verbs,
+					  &coords_length, coords));
+  g_assert_cmpuint (verbs_length, ==, 29);
+  g_assert_cmpuint (coords_length, ==, 104);
+  g_assert_cmpuint (verbs[0], ==, HB_DRAW_VERB_MOVE_TO);
+  g_assert_cmpuint (verbs[1], ==, HB_DRAW_VERB_QUADRATIC_TO);
+  g_assert_cmpfloat (coords[0], ==, 275.f);
+  g_assert_cmpfloat (coords[1], ==, 442.f);
+
+  /* The path matches what the draw callbacks receive. */
+  draw_data.consumed = 0;
+  hb_font_draw_glyph (font, 3, funcs, &draw_data);
+  verbs_length = G_N_ELEMENTS (verbs);
+  coords_length = G_N_ELEMENTS (coords);
+  g_assert_true (hb_font_get_glyph_path (font, 3, HB_DRAW_PATH_FLAG_DEFAULT,
+					 &verbs_length, verbs,
+					 &coords_length, coords));
+  draw_data2.consumed = 0;
+  _replay_path (verbs, verbs_length, coords, coords_length, funcs, &draw_data2);
+  g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+
+  /* Quadratics are converted like for draw funcs without a quadratic_to callback. */
+  draw_data.consumed = 0;
+  hb_font_draw_glyph (font, 3, funcs2, &draw_data);
+  verbs_length = G_N_ELEMENTS (verbs);
+  coords_length = G_N_ELEMENTS (coords);
+  g_assert_true (hb_font_get_glyph_path (font, 3, HB_DRAW_PATH_FLAG_CUBICS_ONLY,
+					 &verbs_length, verbs,
+					 &coords_length, coords));
+  for (unsigned i = 0; i < verbs_length; i++)
+    g_assert_cmpuint (verbs[i], !=, HB_DRAW_VERB_QUADRATIC_TO);
+  draw_data2.consumed = 0;
+  _replay_path (verbs, verbs_length, coords, coords_length, funcs2, &draw_data2);
+  g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+
+  /* Empty glyph. */
+  verbs_length = G_N_ELEMENTS (verbs);
+  coords_length = G_N_ELEMENTS (coords);
+  g_assert_true (hb_font_get_glyph_path (font, 0, HB_DRAW_PATH_FLAG_DEFAULT,
+					 &verbs_length, verbs,
+					 &coords_length, coords));
+  g_assert_cmpuint (verbs_length, ==, 0);
+  g_assert_cmpuint (coords_length, ==, 0);
+
+  hb_font_destroy (font);
+}
+
 static void
 test_hb_draw_cff1 (void)
 {
@@ -1064,6 +1175,260 @@ test_hb_draw_subfont_scale (void)
   }
 }
 
+static void
+test_hb_draw_outline_cache (void)
+{
+  char str[2048];
+  char str2[2048];
+  draw_data_t draw_data = {
+    .str = str,
+    .size = sizeof (str)
+  };
+  draw_data_t draw_data2 = {
+    .str = str2,
+    .size = sizeof (str2)
+  };
+  const char *font_files[] = {
+    "fonts/OpenSans-Regular.ttf",
+    "fonts/SourceSansPro-Regular.otf",
+    "fonts/AdobeVFPrototype-Subset.otf",
+  };
+  unsigned hits, misses;
+
+  for (unsigned i = 0; i < G_N_ELEMENTS (font_files); i++)
+  {
+    hb_face_t *face = hb_test_open_font_file (font_files[i]);
+    hb_font_t *font = hb_font_create (face);
+    hb_font_t *cached_font = hb_font_create (face);
+    hb_face_destroy (face);
+
+    g_assert_cmpuint (hb_ot_font_get_outline_cache_capacity (cached_font), ==, 0);
+    hb_ot_font_set_outline_cache_capacity (cached_font, 2);
+    g_assert_cmpuint (hb_ot_font_get_outline_cache_capacity (cached_font), ==, 2);
+
+    for (unsigned round = 0; round < 3; round++)
+    {
+      if (round == 1)
+      {
+	/* Cached outlines survive scale and slant changes. */
+	hb_font_set_scale (font, 2000, 3000);
+	hb_font_set_scale (cached_font, 2000, 3000);
+	hb_font_set_synthetic_slant (font, 0.2f);
+	hb_font_set_synthetic_slant (cached_font, 0.2f);
+      }
+      else if (round == 2)
+      {
+	hb_variation_t var;
+	var.tag = HB_TAG ('w','g','h','t');
+	var.value = 800;
+	hb_font_set_variations (font, &var, 1);
+	hb_font_set_variations (cached_font, &var, 1);
+      }
+
+      for (hb_codepoint_t gid = 1; gid < 4; gid++)
+	for (unsigned repeat = 0; repeat < 2; repeat++)
+	{
+	  draw_data.consumed = 0;
+	  draw_data2.consumed = 0;
+	  hb_font_draw_glyph (font, gid, funcs, &draw_data);
+	  hb_font_draw_glyph (cached_font, gid, funcs, &draw_data2);
+	  g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+	}
+    }
+
+    /* Three glyphs cycle through two slots, so in each round the first
+     * draw of a glyph misses and the repeat hits. */
+    hb_ot_font_get_outline_cache_stats (cached_font, &hits, &misses);
+    g_assert_cmpuint (hits, ==, 9);
+    g_assert_cmpuint (misses, ==, 9);
+
+    hb_ot_font_set_outline_cache_capacity (cached_font, 0);
+    g_assert_cmpuint (hb_ot_font_get_outline_cache_capacity (cached_font), ==, 0);
+    hb_ot_font_get_outline_cache_stats (cached_font, &hits, &misses);
+    g_assert_cmpuint (hits, ==, 0);
+    g_assert_cmpuint (misses, ==, 0);
+
+    hb_font_destroy (font);
+    hb_font_destroy (cached_font);
+  }
+}
+
+static void
+test_hb_draw_charstring_cache (void)
+{
+  char str[2048];
+  char str2[2048];
+  draw_data_t draw_data = {
+    .str = str,
+    .size = sizeof (str)
+  };
+  draw_data_t draw_data2 = {
+    .str = str2,
+    .size = sizeof (str2)
+  };
+  const char *font_files[] = {
+    "fonts/cff1_seac.otf",
+    "fonts/SourceSansPro-Regular.otf",
+    "fonts/AdobeVFPrototype-Subset.otf",
+  };
+  unsigned hits, misses, size;
+
+  for (unsigned i = 0; i < G_N_ELEMENTS (font_files); i++)
+  {
+    hb_face_t *face = hb_test_open_font_file (font_files[i]);
+    hb_face_t *cached_face = hb_test_open_font_file (font_files[i]);
+    hb_font_t *font = hb_font_create (face);
+    hb_font_t *cached_font = hb_font_create (cached_face);
+    hb_face_destroy (face);
+
+    hb_ot_face_get_charstring_cache_stats (cached_face, &hits, &misses, &size);
+    g_assert_cmpuint (hits, ==, 0);
+    g_assert_cmpuint (misses, ==, 0);
+    g_assert_cmpuint (size, ==, 0);
+    hb_ot_face_set_charstring_cache_max_size (cached_face, 1 << 20);
+
+    for (unsigned round = 0; round < 2; round++)
+    {
+      if (round == 1)
+      {
+	hb_variation_t var;
+	var.tag = HB_TAG ('w','g','h','t');
+	var.value = 800;
+	hb_font_set_variations (font, &var, 1);
+	hb_font_set_variations (cached_font, &var, 1);
+      }
+
+      for (hb_codepoint_t gid = 1; gid < 4; gid++)
+	for (unsigned repeat = 0; repeat < 2; repeat++)
+	{
+	  hb_glyph_extents_t extents = {0}, extents2 = {0};
+	  g_assert_cmpint (hb_font_get_glyph_extents (font, gid, &extents), ==,
+			   hb_font_get_glyph_extents (cached_font, gid, &extents2));
+	  g_assert_cmpmem (&extents, sizeof (extents), &extents2, sizeof (extents2));
+
+	  draw_data.consumed = 0;
+	  draw_data2.consumed = 0;
+	  hb_font_draw_glyph (font, gid, funcs, &draw_data);
+	  hb_font_draw_glyph (cached_font, gid, funcs, &draw_data2);
+	  g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+	}
+    }
+
+    /* Each glyph is compiled once for its first extents call; a new
+     * variation instance recompiles it for CFF2 only.  Repeated extents
+     * calls are answered by the font's extents cache.  The CFF2 font
+     * has no glyph 3. */
+    hb_ot_face_get_charstring_cache_stats (cached_face, &hits, &misses, &size);
+    g_assert_cmpuint (misses, ==, i == 2 ? 4 : 3);
+    g_assert_cmpuint (hits, ==, i == 2 ? 8 : 15);
+    g_assert_cmpuint (size, >, 0);
+
+    /* Shrinking the cache below its size empties it. */
+    hb_ot_face_set_charstring_cache_max_size (cached_face, 1);
+    hb_ot_face_get_charstring_cache_stats (cached_face, NULL, NULL, &size);
+    g_assert_cmpuint (size, ==, 0);
+
+    hb_face_destroy (cached_face);
+    hb_font_destroy (font);
+    hb_font_destroy (cached_font);
+  }
+}
+
+typedef struct nested_draw_data_t
+{
+  hb_font_t *font;
+  hb_codepoint_t gid;
+  draw_data_t *draw_data;
+  unsigned calls;
+} nested_draw_data_t;
+
+/* Draws another glyph from within a draw callback. */
+static void
+nested_move_to (hb_draw_funcs_t *dfuncs, nested_draw_data_t *data,
+		hb_draw_state_t *st,
+		float to_x, float to_y,
+		void *user_data)
+{
+  if (data->calls++) return;
+  hb_font_draw_glyph (data->font, data->gid, funcs, data->draw_data);
+}
+
+static void
+test_hb_draw_charstring_cache_instances (void)
+{
+  char str[2048];
+  char str2[2048];
+  draw_data_t draw_data = {
+    .str = str,
+    .size = sizeof (str)
+  };
+  draw_data_t draw_data2 = {
+    .str = str2,
+    .size = sizeof (str2)
+  };
+  hb_variation_t light = {HB_TAG ('w','g','h','t'), 200};
+  hb_variation_t heavy = {HB_TAG ('w','g','h','t'), 900};
+  unsigned hits, misses;
+
+  hb_face_t *face = hb_test_open_font_file ("fonts/AdobeVFPrototype-Subset.otf");
+  hb_face_t *cached_face = hb_test_open_font_file ("fonts/AdobeVFPrototype-Subset.otf");
+  hb_ot_face_set_charstring_cache_max_size (cached_face, 1 << 20);
+  hb_font_t *fonts[2], *cached_fonts[2];
+  for (unsigned i = 0; i < 2; i++)
+  {
+    fonts[i] = hb_font_create (face);
+    cached_fonts[i] = hb_font_create (cached_face);
+    hb_font_set_variations (fonts[i], i ? &heavy : &light, 1);
+    hb_font_set_variations (cached_fonts[i], i ? &heavy : &light, 1);
+  }
+  hb_face_destroy (face);
+
+  /* Two instances of one face take turns without evicting each other's
+   * glyphs.  Repeated extents calls are answered by the font's extents
+   * cache. */
+  for (unsigned repeat = 0; repeat < 2; repeat++)
+    for (hb_codepoint_t gid = 1; gid < 3; gid++)
+      for (unsigned i = 0; i < 2; i++)
+      {
+	hb_glyph_extents_t extents = {0}, extents2 = {0};
+	g_assert (hb_font_get_glyph_extents (fonts[i], gid, &extents));
+	g_assert (hb_font_get_glyph_extents (cached_fonts[i], gid, &extents2));
+	g_assert_cmpmem (&extents, sizeof (extents), &extents2, sizeof (extents2));
+
+	draw_data.consumed = 0;
+	draw_data2.consumed = 0;
+	hb_font_draw_glyph (fonts[i], gid, funcs, &draw_data);
+	hb_font_draw_glyph (cached_fonts[i], gid, funcs, &draw_data2);
+	g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+      }
+
+  hb_ot_face_get_charstring_cache_stats (cached_face, &hits, &misses, NULL);
+  g_assert_cmpuint (misses, ==, 4);
+  g_assert_cmpuint (hits, ==, 8);
+
+  /* A draw callback may draw from the face again, from either instance. */
+  hb_draw_funcs_t *nested_funcs = hb_draw_funcs_create ();
+  hb_draw_funcs_set_move_to_func (nested_funcs, (hb_draw_move_to_func_t) nested_move_to, NULL, NULL);
+  for (unsigned i = 0; i < 2; i++)
+  {
+    nested_draw_data_t nested = {cached_fonts[1 - i], 2, &draw_data2, 0};
+    draw_data.consumed = 0;
+    draw_data2.consumed = 0;
+    hb_font_draw_glyph (fonts[1 - i], 2, funcs, &draw_data);
+    hb_font_draw_glyph (cached_fonts[i], 1, nested_funcs, &nested);
+    g_assert_cmpuint (nested.calls, >, 0);
+    g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+  }
+  hb_draw_funcs_destroy (nested_funcs);
+
+  for (unsigned i = 0; i < 2; i++)
+  {
+    hb_font_destroy (fonts[i]);
+    hb_font_destroy (cached_fonts[i]);
+  }
+  hb_face_destroy (cached_face);
+}
+
 static void
 test_hb_draw_immutable (void)
 {
@@ -1074,6 +1439,231 @@ test_hb_draw_immutable (void)
   hb_draw_funcs_destroy (draw_funcs);
 }
 
+static void
+test_hb_draw_buffer_glyphs (void)
+{
+  char str[1024];
+  draw_data_t draw_data = {
+    .str = str,
+    .size = sizeof (str),
+    .consumed = 0
+  };
+  char str2[1024];
+  draw_data_t draw_data2 = {
+    .str = str2,
+    .size = sizeof (str2),
+    .consumed = 0
+  };
+
+  hb_face_t *face = hb_test_open_font_file ("fonts/Roboto-Regular.abcAE.ttf");
+  hb_font_t *font = hb_font_create (face);
+  hb_face_destroy (face);
+
+  hb_buffer_t *buffer = hb_buffer_create ();
+  hb_buffer_add (buffer, 5, 0);
+  hb_buffer_add (buffer, 5, 1);
+  hb_buffer_set_content_type (buffer, HB_BUFFER_CONTENT_TYPE_GLYPHS);
+
+  /* Without positions, all glyphs are drawn at the origin. */
+  hb_buffer_draw_glyphs (buffer, font, funcs, &draw_data);
+  hb_font_draw_glyph (font, 5, funcs, &draw_data2);
+  hb_font_draw_glyph (font, 5, funcs, &draw_data2);
+  g_assert_cmpmem (str, draw_data.consumed, str2, draw_data2.consumed);
+
+  /* Glyphs are moved by the advances before them and their offsets. */
+  hb_glyph_position_t *pos = hb_buffer_get_glyph_positions (buffer, NULL);
+  pos[0].x_advance = 1000;
+  pos[1].x_offset = 10;
+  pos[1].y_offset = 20;
+  draw_data.consumed = 0;
+  hb_buffer_draw_glyphs (buffer, font, funcs, &draw_data);
+  char expected[] = "M123,1242L317,1536L540,1536L272,1242L123,1242Z"
+		    "M1133,1262L1327,1556L1550,1556L1282,1262L1133,1262Z";
+  g_assert_cmpmem (str, draw_data.consumed, expected, sizeof (expected) - 1);
+
+  hb_buffer_destroy (buffer);
+  hb_font_destroy (font);
+}
+
+static void
+test_hb_draw_raster (void)
+{
+  hb_raster_t *raster = hb_raster_create ();
+  hb_glyph_extents_t extents;
+  uint8_t mask[64 * 64];
+
+  /* Nothing drawn yet. */
+  g_assert_false (hb_raster_get_extents (raster, &extents));
+
+  /* A rectangle covering half of the pixels on its edges. */
+  static const uint8_t verbs[] = {
+    HB_DRAW_VERB_MOVE_TO, HB_DRAW_VERB_LINE_TO, HB_DRAW_VERB_LINE_TO,
+    HB_DRAW_VERB_LINE_TO, HB_DRAW_VERB_CLOSE_PATH,
+  };
+  static const float coords[] = {
+    .5f, .5f,  3.5f, .5f,  3.5f, 2.f,  .5f, 2.f,
+  };
+  hb_raster_add_path (raster, verbs, G_N_ELEMENTS (verbs), coords, G_N_ELEMENTS (coords));
+  g_assert_true (hb_raster_get_extents (raster, &extents));
+  g_assert_cmpint (extents.x_bearing, ==, 0);
+  g_assert_cmpint (extents.y_bearing, ==, 2);
+  g_assert_cmpint (extents.width, ==, 4);
+  g_assert_cmpint (extents.height, ==, -2);
+
+  hb_raster_render (raster, NULL, 4, mask);
+  static const uint8_t expected[] = {
+    128, 255, 255, 128,
+     64, 128, 128,  64,
+  };
+  for (unsigned i = 0; i < G_N_ELEMENTS (expected); i++)
+    g_assert_cmpint (abs (mask[i] - expected[i]), <=, 1);
+
+  /* Rendering a larger area leaves the outside empty. */
+  hb_glyph_extents_t area = {-1, 3, 6, -4};
+  hb_raster_render (raster, &area, 6, mask);
+  for (unsigned x = 0; x < 6; x++)
+  {
+    g_assert_cmpint (mask[x], ==, 0);
+    g_assert_cmpint (mask[3 * 6 + x], ==, 0);
+  }
+  g_assert_cmpint (mask[6 + 0], ==, 0);
+  g_assert_cmpint (mask[6 + 2], ==, 255);
+  g_assert_cmpint (mask[6 + 5], ==, 0);
+
+  hb_raster_clear (raster);
+  g_assert_false (hb_raster_get_extents (raster, &extents));
+
+  /* A glyph drawn through the draw functions rasterizes the same as
+   * its flat path. */
+  hb_face_t *face = hb_test_open_font_file ("fonts/SourceSerifVariable-Roman-VVAR.abc.ttf");
+  hb_font_t *font = hb_font_create (face);
+  hb_face_destroy (face);
+  hb_font_set_scale (font, 40, 40);
+
+  hb_font_draw_glyph (font, 3, hb_raster_get_draw_funcs (), raster);
+  g_assert_true (hb_raster_get_extents (raster, &extents));
+  g_assert_cmpint (extents.width, >, 0);
+  g_assert_cmpint (extents.height, <, 0);
+  g_assert_cmpint (extents.width * -extents.height, <=, (int) sizeof (mask));
+  hb_raster_render (raster, NULL, extents.width, mask);
+
+  unsigned covered = 0;
+  for (int i = 0; i < extents.width * -extents.height; i++)
+    covered += mask[i] == 255;
+  g_assert_cmpuint (covered, >, 0);
+
+  uint8_t path_verbs[64];
+  float path_coords[256];
+  unsigned verbs_length = G_N_ELEMENTS (path_verbs);
+  unsigned coords_length = G_N_ELEMENTS (path_coords);
+  g_assert_true (hb_font_get_glyph_path (font, 3, HB_DRAW_PATH_FLAG_DEFAULT,
+					 &verbs_length, path_verbs,
+					 &coords_length, path_coords));
+  hb_raster_t *raster2 = hb_raster_create ();
+  hb_raster_add_path (raster2, path_verbs, verbs_length, path_coords, coords_length);
+  uint8_t mask2[64 * 64];
+  hb_raster_render (raster2, &extents, extents.width, mask2);
+  g_assert_cmpmem (mask, extents.width * -extents.height,
+		   mask2, extents.width * -extents.height);
+
+  hb_raster_destroy (raster2);
+  hb_raster_destroy (raster);
+  hb_font_destroy (font);
+}
+
+static void
+test_hb_draw_raster_sdf (void)
+{
+  hb_raster_t *raster = hb_raster_create ();
+  uint8_t sdf[12 * 12];
+
+  /* An 8 by 8 square, rendered with its extents grown by the spread. */
+  static const uint8_t verbs[] = {
+    HB_DRAW_VERB_MOVE_TO, HB_DRAW_VERB_LINE_TO, HB_DRAW_VERB_LINE_TO,
+    HB_DRAW_VERB_LINE_TO, HB_DRAW_VERB_CLOSE_PATH,
+  };
+  static const float coords[] = {
+    0.f, 0.f,  0.f, 8.f,  8.f, 8.f,  8.f, 0.f,
+  };
+  hb_raster_add_path (raster, verbs, G_N_ELEMENTS (verbs), coords, G_N_ELEMENTS (coords));
+  hb_raster_render_sdf (raster, NULL, 2.f, 12, sdf);
+
+  /* Saturated far inside and outside. */
+  g_assert_cmpint (sdf[0], ==, 0);
+  g_assert_cmpint (sdf[6 * 12 + 6], ==, 255);
+  /* Half a pixel from the left edge, on either side of it. */
+  g_assert_cmpint (sdf[6 * 12 + 1], ==, 96);
+  g_assert_cmpint (sdf[6 * 12 + 2], ==, 159);
+  /* Symmetric around the center. */
+  for (unsigned y = 0; y < 12; y++)
+    for (unsigned x = 0; x < 12; x++)
+    {
+      g_assert_cmpint (sdf[y * 12 + x], ==, sdf[y * 12 + 11 - x]);
+      g_assert_cmpint (sdf[y * 12 + x], ==, sdf[x * 12 + y]);
+    }
+
+  /* Overlapping contours do not cut into each other. */
+  hb_raster_add_path (raster, verbs, G_N_ELEMENTS (verbs), coords, G_N_ELEMENTS (coords));
+  uint8_t sdf2[12 * 12];
+  hb_raster_render_sdf (raster, NULL, 2.f, 12, sdf2);
+  g_assert_cmpmem (sdf, sizeof (sdf), sdf2, sizeof (sdf2));
+
+  hb_raster_destroy (raster);
+}
+
+static void
+test_hb_draw_raster_atlas (void)
+{
+  hb_face_t *face = hb_test_open_font_file ("fonts/SourceSerifVariable-Roman-VVAR.abc.ttf");
+  hb_font_t *font = hb_font_create (face);
+  hb_face_destroy (face);
+  hb_font_set_scale (font, 20, 20);
+
+  hb_raster_atlas_t *atlas = hb_raster_atlas_create (32, 32);
+  hb_raster_atlas_entry_t entry, entry2;
+  unsigned width, height;
+  const uint8_t *data = hb_raster_atlas_get_data (atlas, &width, &height);
+  g_assert_nonnull (data);
+  g_assert_cmpuint (width, ==, 32);
+  g_assert_cmpuint (height, ==, 32);
+
+  /* Entries hold the same mask as rendering the glyph alone. */
+  hb_raster_t *raster = hb_raster_create ();
+  uint8_t mask[32 * 32];
+  for (hb_codepoint_t glyph = 1; glyph <= 3; glyph++)
+  {
+    g_assert_true (hb_raster_atlas_add_glyph (atlas, font, glyph, &entry));
+    hb_raster_clear (raster);
+    hb_font_draw_glyph (font, glyph, hb_raster_get_draw_funcs (), raster);
+    hb_glyph_extents_t extents;
+    g_assert_true (hb_raster_get_extents (raster, &extents));
+    g_assert_cmpmem (&entry.extents, sizeof (extents), &extents, sizeof (extents));
+    g_assert_cmpuint (entry.x + extents.width, <=, width);
+    g_assert_cmpuint (entry.y - extents.height, <=, height);
+    hb_raster_render (raster, NULL, extents.width, mask);
+    for (int y = 0; y < -extents.height; y++)
+      g_assert_cmpmem (data + (entry.y + y) * width + entry.x, extents.width,
+		       mask + y * extents.width, extents.width);
+
+    /* Adding a glyph again returns its existing entry. */
+    g_assert_true (hb_raster_atlas_add_glyph (atlas, font, glyph, &entry2));
+    g_assert_cmpmem (&entry, sizeof (entry), &entry2, sizeof (entry2));
+  }
+  hb_raster_destroy (raster);
+
+  /* A glyph that does not fit is rejected. */
+  hb_raster_atlas_t *small = hb_raster_atlas_create (4, 4);
+  g_assert_false (hb_raster_atlas_add_glyph (small, font, 3, &entry));
+  hb_raster_atlas_destroy (small);
+
+  hb_raster_atlas_clear (atlas);
+  for (unsigned i = 0; i < width * height; i++)
+    g_assert_cmpint (data[i], ==, 0);
+
+  hb_raster_atlas_destroy (atlas);
+  hb_font_destroy (font);
+}
+
 #ifdef HAVE_FREETYPE
 static void test_hb_draw_ft (void)
 {
@@ -1179,6 +1769,7 @@ main (int argc, char **argv)
   hb_test_add (test_itoa);
   hb_test_add (test_hb_draw_empty);
   hb_test_add (test_hb_draw_glyf);
+  hb_test_add (test_hb_draw_glyph_path);
   hb_test_add (test_hb_draw_cff1);
   hb_test_add (test_hb_draw_cff1_rline);
   hb_test_add (test_hb_draw_cff2);
@@ -1190,7 +1781,14 @@ main (int argc, char **argv)
   hb_test_add (test_hb_draw_drawing_funcs);
   hb_test_add (test_hb_draw_synthetic_slant);
   hb_test_add (test_hb_draw_subfont_scale);
+  hb_test_add (test_hb_draw_outline_cache);
+  hb_test_add (test_hb_draw_charstring_cache);
+  hb_test_add (test_hb_draw_charstring_cache_instances);
   hb_test_add (test_hb_draw_immutable);
+  hb_test_add (test_hb_draw_buffer_glyphs);
+  hb_test_add (test_hb_draw_raster);
+  hb_test_add (test_hb_draw_raster_sdf);
+  hb_test_add (test_hb_draw_raster_atlas);
 #ifdef HAVE_FREETYPE
   hb_test_add (test_hb_draw_ft);
   hb_test_add (test_hb_draw_compare_ot_ft);
@@ -68,6 +68,50 @@ test_extents_cff1 (void)
   hb_font_destroy (font_j);
 }
 
+static void
+test_extents_cff1_cached (void)
+{
+  hb_face_t *face = hb_test_open_font_file ("fonts/SourceSansPro-Regular.abc.otf");
+  g_assert (face);
+  hb_font_t *font = hb_font_create (face);
+  hb_face_destroy (face);
+  g_assert (font);
+  hb_ot_font_set_funcs (font);
+
+  /* Miss, then hit. */
+  hb_glyph_extents_t  extents;
+  for (unsigned i = 0; i < 2; i++)
+  {
+    hb_bool_t result = hb_font_get_glyph_extents (font, 1, &extents);
+    g_assert (result);
+
+    g_assert_cmpint (extents.x_bearing, ==, 52);
+    g_assert_cmpint (extents.y_bearing, ==, 498);
+    g_assert_cmpint (extents.width, ==, 381);
+    g_assert_cmpint (extents.height, ==, -510);
+  }
+
+  /* Hit, scaled at the new scale. */
+  hb_font_set_scale (font, 2000, 2000);
+  hb_bool_t result = hb_font_get_glyph_extents (font, 1, &extents);
+  g_assert (result);
+
+  g_assert_cmpint (extents.x_bearing, ==, 104);
+  g_assert_cmpint (extents.y_bearing, ==, 996);
+  g_assert_cmpint (extents.width, ==, 762);
+  g_assert_cmpint (extents.height, ==, -1020);
+
+  /* Glyphs sharing a cache slot with glyph 1 miss, and do not exist. */
+  g_assert (!hb_font_get_glyph_extents (font, 1 + 1024, &extents));
+  g_assert (!hb_font_get_glyph_extents (font, 1 + 0x10000, &extents));
+
+  /* Glyph ids beyond what the cache can hold never match an empty slot. */
+  g_assert (!hb_font_get_glyph_extents (font, 0x3FFFC00, &extents));
+  g_assert (!hb_font_get_glyph_extents (font, 0xFFFFFFFF, &extents));
+
+  hb_font_destroy (font);
+}
+
 static void
 test_extents_cff1_flex (void)
 {
@@ -221,6 +265,7 @@ main (int argc, char **argv)
   hb_test_init (&argc, &argv);
 
   hb_test_add (test_extents_cff1);
+  hb_test_add (test_extents_cff1_cached);
   hb_test_add (test_extents_cff1_flex);
   hb_test_add (test_extents_cff1_seac);
   hb_test_add (test_extents_cff2);
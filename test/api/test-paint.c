@@ -637,6 +637,65 @@ test_color_stops_ft (void)
     g_test_skip ("FreeType COLRv1 support not present");
 }
 
+static void
+test_hb_paint_cache (void)
+{
+  hb_face_t *face;
+  hb_font_t *font, *cached_font;
+  hb_paint_funcs_t *funcs;
+  unsigned int glyph_count, hits, misses;
+
+  face = hb_test_open_font_file (TEST_GLYPHS);
+  glyph_count = hb_face_get_glyph_count (face);
+  font = hb_font_create (face);
+  cached_font = hb_font_create (face);
+  funcs = get_test_paint_funcs ();
+
+  g_assert_cmpuint (hb_ot_font_get_paint_cache_capacity (cached_font), ==, 0);
+  hb_ot_font_set_paint_cache_capacity (cached_font, 64);
+  g_assert_cmpuint (hb_ot_font_get_paint_cache_capacity (cached_font), ==, 64);
+
+  for (unsigned int round = 0; round < 2; round++)
+  {
+    for (hb_codepoint_t glyph = 1; glyph < glyph_count; glyph++)
+    {
+      paint_data_t data, cached_data;
+
+      data.string = g_string_new ("");
+      data.level = 0;
+      hb_font_paint_glyph (font, glyph, funcs, &data, 0, HB_COLOR (0, 0, 0, 255));
+
+      for (unsigned int repeat = 0; repeat < 2; repeat++)
+      {
+	cached_data.string = g_string_new ("");
+	cached_data.level = 0;
+	hb_font_paint_glyph (cached_font, glyph, funcs, &cached_data, 0, HB_COLOR (0, 0, 0, 255));
+	g_assert_cmpstr (data.string->str, ==, cached_data.string->str);
+	g_string_free (cached_data.string, TRUE);
+      }
+
+      g_string_free (data.string, TRUE);
+    }
+
+    /* Changing the font drops all cached glyphs. */
+    hb_font_set_scale (font, 2000, 1300);
+    hb_font_set_scale (cached_font, 2000, 1300);
+  }
+
+  hb_ot_font_get_paint_cache_stats (cached_font, &hits, &misses);
+  g_assert_cmpuint (hits, ==, 2 * (glyph_count - 1));
+  g_assert_cmpuint (misses, ==, 2 * (glyph_count - 1));
+
+  hb_ot_font_set_paint_cache_capacity (cached_font, 0);
+  hb_ot_font_get_paint_cache_stats (cached_font, &hits, &misses);
+  g_assert_cmpuint (hits, ==, 0);
+  g_assert_cmpuint (misses, ==, 0);
+
+  hb_font_destroy (cached_font);
+  hb_font_destroy (font);
+  hb_face_destroy (face);
+}
+
 int
 main (int argc, char **argv)
 {
@@ -663,6 +722,8 @@ main (int argc, char **argv)
   hb_test_add (test_color_stops_ot);
   hb_test_add (test_color_stops_ft);
 
+  hb_test_add (test_hb_paint_cache);
+
   status = hb_test_run();
 
   return status;
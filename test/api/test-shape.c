@@ -180,6 +180,82 @@ test_shape_clusters (void)
 }
 
 
+static unsigned
+shape_ascii (hb_font_t *font, const char *text,
+	     hb_codepoint_t *glyphs, unsigned *clusters, unsigned size)
+{
+  hb_buffer_t *buffer = hb_buffer_create ();
+  hb_buffer_add_utf8 (buffer, text, -1, 0, -1);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_shape (font, buffer, NULL, 0);
+  unsigned len;
+  hb_glyph_info_t *infos = hb_buffer_get_glyph_infos (buffer, &len);
+  for (unsigned i = 0; i < len && i < size; i++)
+  {
+    glyphs[i] = infos[i].codepoint;
+    clusters[i] = infos[i].cluster;
+  }
+  hb_buffer_destroy (buffer);
+  return len;
+}
+
+static unsigned
+shape_ascii_unsafe_to_concat (hb_font_t *font, const char *text,
+			      hb_unicode_funcs_t *unicode)
+{
+  hb_buffer_t *buffer = hb_buffer_create ();
+  hb_buffer_set_unicode_funcs (buffer, unicode);
+  hb_buffer_set_flags (buffer, HB_BUFFER_FLAG_PRODUCE_UNSAFE_TO_CONCAT);
+  hb_buffer_add_utf8 (buffer, text, -1, 0, -1);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_shape (font, buffer, NULL, 0);
+  unsigned len, mask = 0;
+  hb_glyph_info_t *infos = hb_buffer_get_glyph_infos (buffer, &len);
+  for (unsigned i = 0; i < len && i < 32; i++)
+    if (hb_glyph_info_get_glyph_flags (&infos[i]) & HB_GLYPH_FLAG_UNSAFE_TO_CONCAT)
+      mask |= 1u << i;
+  hb_buffer_destroy (buffer);
+  return mask;
+}
+
+static void
+test_shape_ascii_fast_path (void)
+{
+  hb_face_t *face = hb_test_open_font_file ("fonts/Roboto-Regular.gsub.fi.ttf");
+  hb_font_t *font = hb_font_create (face);
+  hb_codepoint_t glyphs[4], f, i;
+  unsigned clusters[4];
+
+  g_assert (hb_font_get_nominal_glyph (font, 'f', &f));
+  g_assert (hb_font_get_nominal_glyph (font, 'i', &i));
+
+  /* The 'fi' ligature still forms in all-ASCII text. */
+  g_assert_cmpuint (shape_ascii (font, "fi", glyphs, clusters, 4), ==, 1);
+  g_assert_cmpuint (glyphs[0], !=, f);
+  g_assert_cmpuint (clusters[0], ==, 0);
+
+  /* Characters without a glyph map to notdef. */
+  g_assert_cmpuint (shape_ascii (font, "fix", glyphs, clusters, 4), ==, 2);
+  g_assert_cmpuint (glyphs[1], ==, 0);
+  g_assert_cmpuint (clusters[1], ==, 2);
+
+  /* Single letters keep their nominal glyphs. */
+  g_assert_cmpuint (shape_ascii (font, "if", glyphs, clusters, 4), ==, 2);
+  g_assert_cmpuint (glyphs[0], ==, i);
+  g_assert_cmpuint (glyphs[1], ==, f);
+
+  /* Unsafe-to-concat flags are the same as with Unicode functions that
+   * never take the fast path. */
+  hb_unicode_funcs_t *unicode = hb_unicode_funcs_create (hb_unicode_funcs_get_default ());
+  unsigned mask = shape_ascii_unsafe_to_concat (font, "ff", unicode);
+  g_assert_cmpuint (mask, !=, 0);
+  g_assert_cmpuint (shape_ascii_unsafe_to_concat (font, "ff", hb_unicode_funcs_get_default ()), ==, mask);
+  hb_unicode_funcs_destroy (unicode);
+
+  hb_font_destroy (font);
+  hb_face_destroy (face);
+}
+
 static void
 test_shape_list (void)
 {
@@ -200,6 +276,7 @@ main (int argc, char **argv)
 
   hb_test_add (test_shape);
   hb_test_add (test_shape_clusters);
+  hb_test_add (test_shape_ascii_fast_path);
   /* TODO test fallback shaper */
   /* TODO test shaper_full */
   hb_test_add (test_shape_list);
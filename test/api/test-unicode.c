@@ -977,6 +977,76 @@ test_unicode_normalization (gconstpointer user_data)
 }
 
 
+static void
+test_unicode_script_runs (gconstpointer user_data)
+{
+  hb_unicode_funcs_t *uf = (hb_unicode_funcs_t *) user_data;
+  hb_script_run_t runs[8];
+  unsigned int count;
+
+  /* Empty text. */
+  count = G_N_ELEMENTS (runs);
+  g_assert_cmpuint (hb_unicode_script_runs_utf8 (uf, "", -1, 0, &count, runs), ==, 0);
+  g_assert_cmpuint (count, ==, 0);
+
+  /* No real script. */
+  count = G_N_ELEMENTS (runs);
+  g_assert_cmpuint (hb_unicode_script_runs_utf8 (uf, "123 !", -1, 0, &count, runs), ==, 1);
+  g_assert_cmpuint (runs[0].offset, ==, 0);
+  g_assert_cmpuint (runs[0].length, ==, 5);
+  g_assert_cmpuint (runs[0].script, ==, HB_SCRIPT_COMMON);
+
+  /* Leading Common takes the following script; brackets pair up.
+   * "(א) abc (αβ) d" */
+  {
+    const char *text = "(\xD7\x90) abc (\xCE\xB1\xCE\xB2) d";
+    count = G_N_ELEMENTS (runs);
+    g_assert_cmpuint (hb_unicode_script_runs_utf8 (uf, text, -1, 0, &count, runs), ==, 4);
+    g_assert_cmpuint (count, ==, 4);
+    g_assert_cmpuint (runs[0].offset, ==, 0);
+    g_assert_cmpuint (runs[0].length, ==, 5);
+    g_assert_cmpuint (runs[0].script, ==, HB_SCRIPT_HEBREW);
+    g_assert_cmpuint (runs[1].offset, ==, 5);
+    g_assert_cmpuint (runs[1].length, ==, 5);
+    g_assert_cmpuint (runs[1].script, ==, HB_SCRIPT_LATIN);
+    g_assert_cmpuint (runs[2].offset, ==, 10);
+    g_assert_cmpuint (runs[2].length, ==, 4);
+    g_assert_cmpuint (runs[2].script, ==, HB_SCRIPT_GREEK);
+    g_assert_cmpuint (runs[3].offset, ==, 14);
+    g_assert_cmpuint (runs[3].length, ==, 3);
+    g_assert_cmpuint (runs[3].script, ==, HB_SCRIPT_LATIN);
+
+    /* Partial fetches. */
+    count = 2;
+    g_assert_cmpuint (hb_unicode_script_runs_utf8 (uf, text, -1, 3, &count, runs), ==, 4);
+    g_assert_cmpuint (count, ==, 1);
+    g_assert_cmpuint (runs[0].offset, ==, 14);
+    g_assert_cmpuint (hb_unicode_script_runs_utf8 (uf, text, -1, 0, NULL, NULL), ==, 4);
+  }
+
+  /* Inherited marks stay in their run; offsets are in code units. */
+  {
+    const uint16_t text[] = {0x0928, 0x094D, 0x0301, 0x0020, 0x0431, 0x0301, 0};
+    count = G_N_ELEMENTS (runs);
+    g_assert_cmpuint (hb_unicode_script_runs_utf16 (uf, text, -1, 0, &count, runs), ==, 2);
+    g_assert_cmpuint (runs[0].offset, ==, 0);
+    g_assert_cmpuint (runs[0].length, ==, 4);
+    g_assert_cmpuint (runs[0].script, ==, HB_SCRIPT_DEVANAGARI);
+    g_assert_cmpuint (runs[1].offset, ==, 4);
+    g_assert_cmpuint (runs[1].length, ==, 2);
+    g_assert_cmpuint (runs[1].script, ==, HB_SCRIPT_CYRILLIC);
+  }
+  {
+    const uint32_t text[] = {0x0061, 0x4E00, 0x3042, 0x1F600};
+    count = G_N_ELEMENTS (runs);
+    g_assert_cmpuint (hb_unicode_script_runs_utf32 (uf, text, 4, 0, &count, runs), ==, 3);
+    g_assert_cmpuint (runs[2].offset, ==, 2);
+    g_assert_cmpuint (runs[2].length, ==, 2);
+    g_assert_cmpuint (runs[2].script, ==, HB_SCRIPT_HIRAGANA);
+  }
+}
+
+
 
 int
 main (int argc, char **argv)
@@ -989,6 +1059,7 @@ main (int argc, char **argv)
   hb_test_add_data_flavor (hb_unicode_funcs_get_default (),          "default", test_unicode_properties_strict);
   hb_test_add_data_flavor (hb_unicode_funcs_get_default (),          "default", test_unicode_normalization);
   hb_test_add_data_flavor ((gconstpointer) script_roundtrip_default, "default", test_unicode_script_roundtrip);
+  hb_test_add_data_flavor (hb_unicode_funcs_get_default (),          "default", test_unicode_script_runs);
 #ifdef HAVE_GLIB
   hb_test_add_data_flavor (hb_glib_get_unicode_funcs (),             "glib",    test_unicode_properties_lenient);
   hb_test_add_data_flavor (hb_glib_get_unicode_funcs (),             "glib",    test_unicode_normalization);